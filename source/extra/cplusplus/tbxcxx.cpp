@@ -81,7 +81,7 @@ void * operator new(size_t size)
   
   /* Attempt to allocate a block from a memory pool with the same size. If non-existant,
    * automatically create the memory pool. If no more free blocks available in the
-   * memory pool, automatically expand the memory pool by adding one more block.
+   * memory pool, automatically expand the memory pool according to its growth policy.
    */
   result = TbxMemPoolAllocateAuto(size);
   /* Verify the allocation result. */
@@ -101,13 +101,13 @@ void * pvPortMalloc(size_t xWantedSize)
     /* The allocation failed. This can have two reasons:
       *   1. A memory pool for the requested size hasn't yet been created.
       *   2. The memory pool for the requested size has no more free blocks.
-      * Both situations can be solved by calling TbxMemPoolCreate(), as this
-      * function automatically extends a memory pool, if it was created before.
-      * Note that ther is not need to check the return value, because we will
-      * attempts to allocate again right afterwards. We can catch the error
-      * there in case the allocation fails.
+      * Both situations can be solved by calling TbxMemPoolGrow(), as this
+      * function automatically creates or extends a memory pool, according to
+      * its growth policy. Note that ther is not need to check the return value,
+      * because we will attempts to allocate again right afterwards. We can catch
+      * the error there in case the allocation fails.
       */
-    (void)TbxMemPoolCreate(1U, xWantedSize);
+    (void)TbxMemPoolGrow(xWantedSize);
 
     /* Assuming sufficient heap was available, the memory pool was extended.
      * Attempt to allocate the block again.
@@ -59,6 +59,10 @@
 #include "tbx_heap.h"                       /* Heap memory allocation                  */
 #include "tbx_list.h"                       /* Linked lists                            */
 #include "tbx_mempool.h"                    /* Pool based heap memory manager          */
+#include "tbx_bitpool.h"                    /* Bitmap pool for tiny objects            */
+#include "tbx_tlsf.h"                       /* TLSF memory allocator                   */
+#include "tbx_buddy.h"                      /* Buddy memory allocator                  */
+#include "tbx_hmem.h"                       /* Handle based memory allocator           */
 #include "tbx_random.h"                     /* Random number generator                 */
 #include "tbx_checksum.h"                   /* Checksum module                         */
 #include "tbx_crypto.h"                     /* Cryptography module                     */
@@ -37,8 +37,12 @@
 /****************************************************************************************
 * Include files
 ****************************************************************************************/
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE                          /* For MAP_ANONYMOUS and madvise()    */
+#endif
 #include "microtbx.h"                            /* MicroTBX global header             */
 #include <pthread.h>                             /* Posix thread utilities             */
+#include <sys/mman.h>                            /* Memory management declarations     */
 #include <stdbool.h>                             /* Boolean definitions                */
 #include <stdatomic.h>                           /* Atomic operations                  */
 
@@ -51,6 +55,11 @@
  */
 #define TBX_PORT_CPU_SR_IRQ_EN    (1U)
 
+/** \brief Size of an explicit huge page in bytes. This is the default huge page size on
+ *         x86-64 and on AArch64 with 4 KiB base pages.
+ */
+#define TBX_PORT_HUGE_PAGE_SIZE   (2UL * 1024UL * 1024UL)
+
 
 /****************************************************************************************
 * Local data declarations
@@ -115,4 +124,252 @@ void TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr)
 } /*** end of TbxPortInterruptsRestore ***/
 
 
+/************************************************************************************//**
+** \brief     Atomically reads the value of a size_t variable that is shared between
+**            threads.
+** \param     valuePtr Pointer to the variable to read.
+** \return    The current value of the variable.
+**
+****************************************************************************************/
+size_t TbxPortAtomicLoad(size_t volatile const * valuePtr)
+{
+  /* Perform the read with acquire semantics, such that writes made by the thread that
+   * stored this value, are also visible to the calling thread.
+   */
+  return __atomic_load_n(valuePtr, __ATOMIC_ACQUIRE);
+} /*** end of TbxPortAtomicLoad ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the value of a size_t variable with the expected value
+**            and, only if they are equal, overwrites it with the desired value.
+** \param     valuePtr Pointer to the variable to update.
+** \param     expected The value that the variable should currently have.
+** \param     desired The new value to write to the variable.
+** \return    TBX_TRUE if the variable was updated, TBX_FALSE if it was changed by
+**            another thread in the meantime.
+**
+****************************************************************************************/
+uint8_t TbxPortAtomicCompareExchange(size_t volatile * valuePtr,
+                                     size_t            expected,
+                                     size_t            desired)
+{
+  uint8_t result = TBX_FALSE;
+
+  /* Attempt to perform the atomic compare and exchange operation. */
+  if (__atomic_compare_exchange_n(valuePtr, &expected, desired, false,
+                                  __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+  {
+    /* Update the result accordingly. */
+    result = TBX_TRUE;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchange ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically reads the value of a pointer that is shared between threads.
+** \param     valuePtr Pointer to the pointer to read.
+** \return    The current value of the pointer.
+**
+****************************************************************************************/
+void * TbxPortAtomicLoadPtr(void * volatile const * valuePtr)
+{
+  /* Perform the read with acquire semantics, such that the writes to the memory that it
+   * points to, made before the pointer was stored, are also visible to the calling
+   * thread.
+   */
+  return __atomic_load_n(valuePtr, __ATOMIC_ACQUIRE);
+} /*** end of TbxPortAtomicLoadPtr ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically writes the value of a pointer that is shared between threads.
+** \param     valuePtr Pointer to the pointer to write.
+** \param     value The new value of the pointer.
+**
+****************************************************************************************/
+void TbxPortAtomicStorePtr(void * volatile * valuePtr,
+                           void            * value)
+{
+  /* Perform the write with release semantics, such that all writes made before it, are
+   * visible to the thread that reads the pointer with TbxPortAtomicLoadPtr().
+   */
+  __atomic_store_n(valuePtr, value, __ATOMIC_RELEASE);
+} /*** end of TbxPortAtomicStorePtr ***/
+
+
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+/************************************************************************************//**
+** \brief     Reads the value of a tagged pointer that is shared between threads. The tag
+**            is read before the pointer. The two are therefore not necessarily read as a
+**            pair. That is fine, because the tag changes with each update of the
+**            pointer: A subsequent TbxPortAtomicCompareExchangeTagged() with the read
+**            value simply fails, if the pointer was updated in between.
+** \param     valuePtr Pointer to the tagged pointer to read.
+** \return    The current value of the tagged pointer.
+**
+****************************************************************************************/
+tTbxPortTaggedPtr TbxPortAtomicLoadTagged(tTbxPortTaggedPtr volatile const * valuePtr)
+{
+  tTbxPortTaggedPtr result;
+
+  /* Read the tag first and then the pointer, both with acquire semantics. */
+  result.tag = __atomic_load_n(&valuePtr->tag, __ATOMIC_ACQUIRE);
+  result.ptr = __atomic_load_n(&valuePtr->ptr, __ATOMIC_ACQUIRE);
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicLoadTagged ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the value of a tagged pointer with the expected value
+**            and, only if both the pointer and the tag are equal, overwrites it with the
+**            desired value.
+** \param     valuePtr Pointer to the tagged pointer to update.
+** \param     expected The value that the tagged pointer should currently have.
+** \param     desired The new value to write to the tagged pointer.
+** \return    TBX_TRUE if the tagged pointer was updated, TBX_FALSE if it was changed by
+**            another thread in the meantime.
+**
+****************************************************************************************/
+uint8_t TbxPortAtomicCompareExchangeTagged(tTbxPortTaggedPtr volatile * valuePtr,
+                                           tTbxPortTaggedPtr            expected,
+                                           tTbxPortTaggedPtr            desired)
+{
+  uint8_t result = TBX_FALSE;
+#if (__SIZEOF_POINTER__ == 8)
+  typedef unsigned __int128 tTaggedWord;
+#else
+  typedef uint64_t tTaggedWord;
+#endif
+  /* Union for viewing a tagged pointer as one word of twice the pointer width. */
+  union
+  {
+    tTbxPortTaggedPtr tagged;
+    tTaggedWord       word;
+  } expectedVal, desiredVal;
+
+  /* Convert the tagged pointers to words. */
+  expectedVal.tagged = expected;
+  desiredVal.tagged = desired;
+  /* Attempt to perform the double width atomic compare and exchange operation. */
+  if (__sync_bool_compare_and_swap((tTaggedWord volatile *)valuePtr,
+                                   expectedVal.word, desiredVal.word))
+  {
+    /* Update the result accordingly. */
+    result = TBX_TRUE;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchangeTagged ***/
+#endif /* (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Initializes a lock, such that it can be acquired and released afterwards.
+**            Must be called once, before the lock is used.
+** \param     lockPtr Pointer to the lock to initialize.
+**
+****************************************************************************************/
+void TbxPortLockInit(tTbxPortLock * lockPtr)
+{
+  /* Initialize the lock as a mutex with default attributes. */
+  (void)pthread_mutex_init(lockPtr, NULL);
+} /*** end of TbxPortLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Acquires a lock. Blocks the calling thread for as long as another thread
+**            holds the same lock. Note that locks do not nest.
+** \param     lockPtr Pointer to the lock to acquire.
+**
+****************************************************************************************/
+void TbxPortLockAcquire(tTbxPortLock * lockPtr)
+{
+  /* Lock the mutex. */
+  (void)pthread_mutex_lock(lockPtr);
+} /*** end of TbxPortLockAcquire ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a lock that was previously acquired with TbxPortLockAcquire().
+** \param     lockPtr Pointer to the lock to release.
+**
+****************************************************************************************/
+void TbxPortLockRelease(tTbxPortLock * lockPtr)
+{
+  /* Unlock the mutex. */
+  (void)pthread_mutex_unlock(lockPtr);
+} /*** end of TbxPortLockRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Maps a new block of anonymous, zero initialized memory into the address
+**            space of the process. Used by the heap to grow beyond TBX_CONF_HEAP_SIZE.
+**            The memory is never unmapped, because free-ing of heap memory is not
+**            supported.
+** \param     size Number of bytes to map.
+** \param     hugePages TBX_TRUE to back the memory with huge pages, TBX_FALSE
+**            otherwise. First tries explicit huge pages (MAP_HUGETLB). These can only be
+**            mapped in multiples of the huge page size, so for this attempt the size is
+**            rounded up to it. The extra bytes remain unused. If no huge pages are
+**            reserved on the system, it falls back to regular pages, while advising the
+**            kernel to use transparent huge pages for them.
+** \return    Pointer to the start of the mapped memory if successful, NULL otherwise.
+**
+****************************************************************************************/
+void * TbxPortMemoryMap(size_t  size,
+                        uint8_t hugePages)
+{
+  void * result = NULL;
+  void * mapPtr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  size_t sizeHuge;
+
+  /* Should the memory be backed by huge pages? */
+  if (hugePages == TBX_TRUE)
+  {
+    /* Round the size up to a multiple of the huge page size. */
+    sizeHuge = ((size + (TBX_PORT_HUGE_PAGE_SIZE - 1U)) / TBX_PORT_HUGE_PAGE_SIZE) * \
+               TBX_PORT_HUGE_PAGE_SIZE;
+    /* Only continue if the rounding did not overflow. */
+    if (sizeHuge >= size)
+    {
+      /* Attempt to map the memory using explicit huge pages. Only works if the system
+       * has huge pages reserved.
+       */
+      mapPtr = mmap(NULL, sizeHuge, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+  }
+#endif
+  /* Memory not yet mapped? */
+  if (mapPtr == MAP_FAILED)
+  {
+    /* Map the memory using regular pages. */
+    mapPtr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+    /* Should the memory be backed by huge pages and was it mapped? */
+    if ( (hugePages == TBX_TRUE) && (mapPtr != MAP_FAILED) )
+    {
+      /* Advise the kernel to use transparent huge pages. Just a hint, so the result
+       * does not matter.
+       */
+      (void)madvise(mapPtr, size, MADV_HUGEPAGE);
+    }
+#endif
+  }
+  /* Was the memory successfully mapped? */
+  if (mapPtr != MAP_FAILED)
+  {
+    /* Update the result accordingly. */
+    result = mapPtr;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortMemoryMap ***/
+
+
 /*********************************** end of tbx_port.c *********************************/
@@ -39,6 +39,46 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <pthread.h>                             /* Posix thread utilities             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief This port implements the TbxPortAtomicXxx() functions, meaning that modules
+ *         can use lock-free algorithms instead of critical sections where possible.
+ */
+#define TBX_PORT_ATOMICS_SUPPORTED               (1U)
+
+/** \brief Storage class specifier for variables that have a separate instance for each
+ *         thread.
+ */
+#define TBX_PORT_THREAD_LOCAL                    __thread
+
+#if ( (__SIZEOF_POINTER__ == 8) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) ) || \
+    ( (__SIZEOF_POINTER__ == 4) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8) )
+/** \brief This port implements the TbxPortAtomicXxxTagged() functions, but only if the
+ *         CPU can compare and exchange two pointers at once. On x86-64 this requires
+ *         the compiler option -mcx16.
+ */
+#define TBX_PORT_ATOMICS_TAGGED_SUPPORTED        (1U)
+#endif
+
+/** \brief This port implements the TbxPortLockXxx() functions, meaning that modules can
+ *         protect their shared data with a lock of their own, instead of with the
+ *         global critical section.
+ */
+#define TBX_PORT_LOCKS_SUPPORTED                 (1U)
+
+/** \brief This port implements the TbxPortMemoryMap() function, meaning that the heap
+ *         can grow by requesting additional memory from the operating system.
+ */
+#define TBX_PORT_MEMORY_MAP_SUPPORTED            (1U)
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -49,6 +89,21 @@ extern "C" {
  */
 typedef uint32_t tTbxPortCpuSR;
 
+/** \brief The type for a lock. Only threads that use the same lock block each other. */
+typedef pthread_mutex_t tTbxPortLock;
+
+/** \brief The type for a pointer that is combined with a tag, such that both can be
+ *         updated with one atomic operation. Aligned to its size, as required by the
+ *         double width compare and exchange instruction.
+ */
+typedef struct
+{
+  /** \brief The pointer. */
+  void   * ptr;
+  /** \brief The tag, which is typically incremented with each update of the pointer. */
+  size_t   tag;
+} __attribute__((aligned(2U * sizeof(void *)))) tTbxPortTaggedPtr;
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,454 @@
+/************************************************************************************//**
+* \file         tbx_bitpool.c
+* \brief        Bitmap pool source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of bits in one word of the bitmap. */
+#define TBX_BITPOOL_WORD_BITS          (sizeof(size_t) * 8U)
+
+/** \brief Largest alignment in bytes of the memory that blocks are taken from. */
+#define TBX_BITPOOL_ALIGN_MAX          (16U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static tTbxBitPool * TbxBitPoolCreateInternal(tTbxHeapRegion    * region,
+                                              size_t              numBlocks,
+                                              size_t              blockSize);
+
+static uint8_t       TbxBitPoolBitFindFirst  (size_t              value);
+
+static tTbxBitPool * TbxBitPoolListFind      (void        const * memPtr);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Linked list with all bitmap pools. Used to find the bitmap pool that a block
+ *         belongs to, based on its address. Bitmap pools are only inserted into this
+ *         list and never removed.
+ */
+static tTbxBitPool * tbxBitPoolList = NULL;
+
+
+/************************************************************************************//**
+** \brief     Creates a new bitmap pool with memory taken from the heap. A bitmap pool
+**            manages blocks of one size, just like a memory pool. However, it keeps
+**            track of its free blocks with a bitmap, instead of a linked list. This way
+**            the blocks do not need a header, which makes a bitmap pool well suited for
+**            large numbers of tiny objects, for example of 8 to 32 bytes. The blocks are
+**            placed right after each other, without padding. The memory that they are
+**            taken from is aligned to the largest power of two that divides the block
+**            size, up to 16 bytes. This matches the alignment that a type with this size
+**            can need. Note that the memory taken from the heap cannot be given back.
+** \param     numBlocks The number of blocks in the bitmap pool.
+** \param     blockSize The size of each block in bytes.
+** \return    Pointer to the newly created bitmap pool if successful, NULL otherwise.
+**            Make sure to store the pointer because it serves as a handle to the bitmap
+**            pool, which is needed when calling the other bitmap pool functions.
+**
+****************************************************************************************/
+tTbxBitPool * TbxBitPoolCreate(size_t numBlocks,
+                               size_t blockSize)
+{
+  /* Create the bitmap pool with memory taken from the default heap. */
+  return TbxBitPoolCreateInternal(NULL, numBlocks, blockSize);
+} /*** end of TbxBitPoolCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new bitmap pool with memory taken from the specified heap region,
+**            instead of from the default heap. Apart from that it works the same as
+**            TbxBitPoolCreate(). Note that the heap region should not be rewound to
+**            before the bitmap pool, because the bitmap pool remains in use.
+** \param     region Pointer to a previously created heap region to take the memory from.
+** \param     numBlocks The number of blocks in the bitmap pool.
+** \param     blockSize The size of each block in bytes.
+** \return    Pointer to the newly created bitmap pool if successful, NULL otherwise.
+**
+****************************************************************************************/
+tTbxBitPool * TbxBitPoolCreateFrom(tTbxHeapRegion * region,
+                                   size_t           numBlocks,
+                                   size_t           blockSize)
+{
+  tTbxBitPool * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (region != NULL)
+  {
+    /* Create the bitmap pool with memory taken from the heap region. */
+    result = TbxBitPoolCreateInternal(region, numBlocks, blockSize);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolCreateFrom ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates a block from the bitmap pool. The bitmap is searched one word at
+**            a time for a set bit, which is found with a count trailing zeros operation.
+**            The search starts at the word where the previous allocation or release took
+**            place, so it typically ends in the first word.
+** \param     pool Pointer to the bitmap pool.
+** \return    Pointer to the start of the newly allocated block if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxBitPoolAllocate(tTbxBitPool * pool)
+{
+  void   * result = NULL;
+  size_t   numWords;
+  size_t   wordIdx;
+  size_t   bitIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(pool != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (pool != NULL)
+  {
+    /* Determine the number of words in the bitmap. */
+    numWords = (pool->numBlocks + (TBX_BITPOOL_WORD_BITS - 1U)) / TBX_BITPOOL_WORD_BITS;
+    /* Obtain mutual exclusive access to the bitmap pool. */
+    TbxCriticalSectionEnter();
+    /* Only search if there is at least one free block. */
+    if (pool->freeBlocks > 0U)
+    {
+      /* Find the first word with a free block, starting at the search index. There is
+       * at least one free block, so this loop always ends.
+       */
+      wordIdx = pool->searchIdx;
+      while (pool->freeBitmap[wordIdx] == 0U)
+      {
+        wordIdx++;
+        /* Wrap around at the end of the bitmap. */
+        if (wordIdx == numWords)
+        {
+          wordIdx = 0U;
+        }
+      }
+      /* Find the first free block in this word and flag it as allocated. */
+      bitIdx = TbxBitPoolBitFindFirst(pool->freeBitmap[wordIdx]);
+      pool->freeBitmap[wordIdx] &= ~((size_t)1U << bitIdx);
+      pool->freeBlocks--;
+      /* Continue the next search at this word. */
+      pool->searchIdx = wordIdx;
+      /* Update the result. */
+      result = &pool->memPtr[((wordIdx * TBX_BITPOOL_WORD_BITS) + bitIdx) *
+                             pool->blockSize];
+    }
+    /* Release mutual exclusive access to the bitmap pool. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a previously allocated block. The blocks do not have a header, so
+**            the bitmap pool that the block belongs to is found based on the address
+**            range of its memory. Once released, the block can be allocated again.
+** \param     memPtr Pointer to the start of the block. Basically, the pointer that was
+**            returned by function TbxBitPoolAllocate(), when the block was initially
+**            allocated.
+**
+****************************************************************************************/
+void TbxBitPoolRelease(void * memPtr)
+{
+  uint8_t     * blockPtr = (uint8_t *)memPtr;
+  tTbxBitPool * pool;
+  size_t        blockIdx;
+  size_t        wordIdx;
+  size_t        bitMask;
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
+  {
+    /* Find the bitmap pool that the block belongs to. */
+    pool = TbxBitPoolListFind(memPtr);
+    /* Verify that the memory belongs to a bitmap pool. */
+    TBX_ASSERT(pool != NULL);
+    /* Only continue if the memory belongs to a bitmap pool. */
+    if (pool != NULL)
+    {
+      /* Determine the index of the block and its location in the bitmap. */
+      blockIdx = (size_t)(blockPtr - pool->memPtr) / pool->blockSize;
+      wordIdx = blockIdx / TBX_BITPOOL_WORD_BITS;
+      bitMask = (size_t)1U << (blockIdx % TBX_BITPOOL_WORD_BITS);
+      /* Obtain mutual exclusive access to the bitmap pool. */
+      TbxCriticalSectionEnter();
+      /* Releasing memory that is not the start of a block, is not allowed. Neither is
+       * releasing a block that is already free.
+       */
+      TBX_ASSERT(blockPtr == &pool->memPtr[blockIdx * pool->blockSize]);
+      TBX_ASSERT((pool->freeBitmap[wordIdx] & bitMask) == 0U);
+      /* Only continue if the memory is the start of an allocated block. */
+      if ( (blockPtr == &pool->memPtr[blockIdx * pool->blockSize]) &&
+           ((pool->freeBitmap[wordIdx] & bitMask) == 0U) )
+      {
+        /* Flag the block as free. */
+        pool->freeBitmap[wordIdx] |= bitMask;
+        pool->freeBlocks++;
+        /* Start the next search at this word, because it now has a free block. */
+        pool->searchIdx = wordIdx;
+      }
+      /* Release mutual exclusive access to the bitmap pool. */
+      TbxCriticalSectionExit();
+    }
+  }
+} /*** end of TbxBitPoolRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of blocks that are still free in the bitmap pool.
+** \param     pool Pointer to the bitmap pool.
+** \return    Number of free blocks.
+**
+****************************************************************************************/
+size_t TbxBitPoolGetFree(tTbxBitPool const * pool)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(pool != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (pool != NULL)
+  {
+    /* Obtain mutual exclusive access to the bitmap pool. */
+    TbxCriticalSectionEnter();
+    /* Read out the number of free blocks. */
+    result = pool->freeBlocks;
+    /* Release mutual exclusive access to the bitmap pool. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new bitmap pool. This function implements TbxBitPoolCreate() and
+**            TbxBitPoolCreateFrom().
+** \param     region Pointer to the heap region to take the memory from, or NULL to take
+**            it from the default heap.
+** \param     numBlocks The number of blocks in the bitmap pool.
+** \param     blockSize The size of each block in bytes.
+** \return    Pointer to the newly created bitmap pool if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxBitPool * TbxBitPoolCreateInternal(tTbxHeapRegion * region,
+                                              size_t           numBlocks,
+                                              size_t           blockSize)
+{
+  tTbxBitPool * result = NULL;
+  tTbxBitPool * pool = NULL;
+  uint8_t     * memPtr;
+  size_t        numWords;
+  size_t        alignment;
+  size_t        adminSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(numBlocks > 0U);
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (numBlocks > 0U) && (blockSize > 0U) )
+  {
+    /* Verify that the total size of the memory can be represented. */
+    TBX_ASSERT(numBlocks <= (((size_t)-1) / blockSize));
+    /* Only continue if the total size of the memory can be represented. */
+    if (numBlocks <= (((size_t)-1) / blockSize))
+    {
+      /* Determine the number of words in the bitmap. */
+      numWords = (numBlocks + (TBX_BITPOOL_WORD_BITS - 1U)) / TBX_BITPOOL_WORD_BITS;
+      /* Determine the alignment, which is the largest power of two that divides the
+       * block size. This way all blocks are aligned to it.
+       */
+      alignment = blockSize & (~blockSize + 1U);
+      if (alignment > TBX_BITPOOL_ALIGN_MAX)
+      {
+        alignment = TBX_BITPOOL_ALIGN_MAX;
+      }
+      /* Create the memory that the bitmap pool manages. This is done first, because
+       * heap memory cannot be released again. Should the administration not fit anymore,
+       * only its smaller allocation is lost.
+       */
+      if (region == NULL)
+      {
+        memPtr = TbxHeapAllocateAligned(numBlocks * blockSize, alignment);
+      }
+      else
+      {
+        memPtr = TbxHeapRegionAllocateAligned(region, numBlocks * blockSize, alignment);
+      }
+      /* Create the bitmap pool's administration. Its bitmap is stored right after it. */
+      if (memPtr != NULL)
+      {
+        adminSize = sizeof(tTbxBitPool) + (numWords * sizeof(size_t));
+        if (region == NULL)
+        {
+          pool = TbxHeapAllocate(adminSize);
+        }
+        else
+        {
+          pool = TbxHeapRegionAllocate(region, adminSize);
+        }
+      }
+      /* Only continue if both could be created. */
+      if (pool != NULL)
+      {
+        /* Initialize the bitmap pool's administration. */
+        pool->memPtr = memPtr;
+        pool->freeBitmap = (size_t *)(void *)&pool[1];
+        pool->blockSize = blockSize;
+        pool->numBlocks = numBlocks;
+        pool->freeBlocks = numBlocks;
+        pool->searchIdx = 0U;
+        /* Initially all blocks are free. */
+        for (size_t wordIdx = 0U; wordIdx < numWords; wordIdx++)
+        {
+          pool->freeBitmap[wordIdx] = (size_t)-1;
+        }
+        /* The bits after the last block in the last word should never be set. */
+        if ((numBlocks % TBX_BITPOOL_WORD_BITS) != 0U)
+        {
+          pool->freeBitmap[numWords - 1U] =
+            ((size_t)1U << (numBlocks % TBX_BITPOOL_WORD_BITS)) - 1U;
+        }
+        /* Obtain mutual exclusive access to the list with bitmap pools. */
+        TbxCriticalSectionEnter();
+        /* Add the bitmap pool at the start of the list. */
+        pool->nextPoolPtr = tbxBitPoolList;
+        tbxBitPoolList = pool;
+        /* Release mutual exclusive access to the list with bitmap pools. */
+        TbxCriticalSectionExit();
+        /* Update the result. */
+        result = pool;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolCreateInternal ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the index of the least significant bit that is set.
+** \param     value The value to scan. Must not be zero.
+** \return    Bit index.
+**
+****************************************************************************************/
+static uint8_t TbxBitPoolBitFindFirst(size_t value)
+{
+  uint8_t result = 0U;
+
+#if defined(__GNUC__)
+  /* Use the compiler's built-in function, which typically maps to a single CPU
+   * instruction.
+   */
+  result = (uint8_t)__builtin_ctzll((unsigned long long)value);
+#else
+  /* Scan the bits, starting at the least significant one. */
+  while ((value & ((size_t)1U << result)) == 0U)
+  {
+    result++;
+  }
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolBitFindFirst ***/
+
+
+/************************************************************************************//**
+** \brief     Finds the bitmap pool that the memory belongs to, based on the address
+**            range of the memory that its blocks are taken from.
+** \param     memPtr Pointer to the memory.
+** \return    Pointer to the bitmap pool if found, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxBitPool * TbxBitPoolListFind(void const * memPtr)
+{
+  tTbxBitPool * result = NULL;
+  tTbxBitPool * pool;
+  uintptr_t     memAddr = (uintptr_t)memPtr;
+  uintptr_t     poolAddr;
+
+  /* Obtain mutual exclusive access to the list with bitmap pools. */
+  TbxCriticalSectionEnter();
+  /* Loop through the bitmap pools, until the one with the memory is found. */
+  pool = tbxBitPoolList;
+  while ( (pool != NULL) && (result == NULL) )
+  {
+    /* Does the memory lie within the address range of this bitmap pool? */
+    poolAddr = (uintptr_t)pool->memPtr;
+    if ( (memAddr >= poolAddr) &&
+         ((memAddr - poolAddr) < (pool->numBlocks * pool->blockSize)) )
+    {
+      /* Update the result, which also ends the loop. */
+      result = pool;
+    }
+    /* Continue with the next bitmap pool. */
+    pool = pool->nextPoolPtr;
+  }
+  /* Release mutual exclusive access to the list with bitmap pools. */
+  TbxCriticalSectionExit();
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBitPoolListFind ***/
+
+
+/*********************************** end of tbx_bitpool.c ******************************/
@@ -0,0 +1,91 @@
+/************************************************************************************//**
+* \file         tbx_bitpool.h
+* \brief        Bitmap pool header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_BITPOOL_H
+#define TBX_BITPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a bitmap pool. Its pointer serves as the handle to the bitmap pool
+ *         which is obtained after creation of the bitmap pool and which is needed in the
+ *         other functions of this module. Note that its elements should be considered
+ *         private and only be accessed internally by this bitmap pool module.
+ */
+typedef struct t_tbx_bit_pool
+{
+  /** \brief Pointer to the start of the memory that blocks are taken from. */
+  uint8_t               * memPtr;
+  /** \brief Bitmap with one bit per block. The bit is set if the block is free. */
+  size_t                * freeBitmap;
+  /** \brief The number of bytes that fit in one block. */
+  size_t                  blockSize;
+  /** \brief Total number of blocks in the bitmap pool. */
+  size_t                  numBlocks;
+  /** \brief Number of blocks that are currently free. */
+  size_t                  freeBlocks;
+  /** \brief Index of the bitmap word where the search for a free block starts. */
+  size_t                  searchIdx;
+  /** \brief Pointer to the next bitmap pool in the list with all bitmap pools. */
+  struct t_tbx_bit_pool * nextPoolPtr;
+} tTbxBitPool;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxBitPool * TbxBitPoolCreate    (size_t              numBlocks,
+                                   size_t              blockSize);
+
+tTbxBitPool * TbxBitPoolCreateFrom(tTbxHeapRegion    * region,
+                                   size_t              numBlocks,
+                                   size_t              blockSize);
+
+void        * TbxBitPoolAllocate  (tTbxBitPool       * pool);
+
+void          TbxBitPoolRelease   (void              * memPtr);
+
+size_t        TbxBitPoolGetFree   (tTbxBitPool const * pool);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_BITPOOL_H */
+/*********************************** end of tbx_bitpool.h ******************************/
@@ -0,0 +1,651 @@
+/************************************************************************************//**
+* \file         tbx_buddy.c
+* \brief        Buddy memory allocator source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a free block. The free list pointers are stored in the block itself,
+ *         because its memory is not used while it is free.
+ */
+typedef struct t_buddy_block
+{
+  /** \brief Pointer to the next block in the free list. */
+  struct t_buddy_block * nextFreePtr;
+  /** \brief Pointer to the previous block in the free list. */
+  struct t_buddy_block * prevFreePtr;
+} tBuddyBlock;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static tTbxBuddy   * TbxBuddyCreateInternal(tTbxHeapRegion  * region,
+                                            size_t            minBlockSize,
+                                            uint8_t           numOrders);
+
+static uint8_t       TbxBuddyBitGet        (uint8_t   const * bitmap,
+                                            size_t            bitIdx);
+
+static void          TbxBuddyBitSet        (uint8_t         * bitmap,
+                                            size_t            bitIdx,
+                                            uint8_t           value);
+
+static size_t        TbxBuddyPairBitIdx    (tTbxBuddy const * buddy,
+                                            uint8_t           order,
+                                            size_t            blockIdx);
+
+static size_t        TbxBuddySplitBitIdx   (tTbxBuddy const * buddy,
+                                            uint8_t           order,
+                                            size_t            blockIdx);
+
+static tBuddyBlock * TbxBuddyBlockGet      (tTbxBuddy const * buddy,
+                                            uint8_t           order,
+                                            size_t            blockIdx);
+
+static void          TbxBuddyBlockInsert   (tTbxBuddy       * buddy,
+                                            uint8_t           order,
+                                            size_t            blockIdx);
+
+static void          TbxBuddyBlockRemove   (tTbxBuddy       * buddy,
+                                            uint8_t           order,
+                                            tBuddyBlock     * block);
+
+
+/************************************************************************************//**
+** \brief     Creates a new buddy allocator with memory taken from the heap. A buddy
+**            allocator manages blocks with a size that is a power of two multiple of the
+**            minimum block size. Each such size is called an order. The block of the
+**            highest order spans all the memory. To allocate memory, a block of the
+**            smallest order that fits is taken. If none is free, a free block of a higher
+**            order is split into two halves, called buddies, until one of the desired order
+**            results. When a block is released, it is merged with its buddy for as long as
+**            the buddy is free as well. Both allocating and releasing memory are
+**            O(log n) operations, with n being the number of orders. This makes it
+**            suitable for recycling large buffers of varying sizes, for example for DMA
+**            and network data, without the need to create a memory pool for each size.
+**            Note that the memory taken from the heap cannot be given back.
+** \param     minBlockSize Size in bytes of the blocks of the lowest order. Must be a power
+**            of two and at least large enough to hold two pointers. All blocks are
+**            aligned to this size.
+** \param     numOrders Number of orders. The total size of the memory that the buddy
+**            allocator manages is (minBlockSize << (numOrders - 1)).
+** \return    Pointer to the newly created buddy allocator if successful, NULL otherwise.
+**            Make sure to store the pointer because it serves as a handle to the buddy
+**            allocator, which is needed when calling the other buddy functions.
+**
+****************************************************************************************/
+tTbxBuddy * TbxBuddyCreate(size_t  minBlockSize,
+                           uint8_t numOrders)
+{
+  /* Create the buddy allocator with memory taken from the default heap. */
+  return TbxBuddyCreateInternal(NULL, minBlockSize, numOrders);
+} /*** end of TbxBuddyCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new buddy allocator with memory taken from the specified heap
+**            region, instead of from the default heap. Apart from that it works the same
+**            as TbxBuddyCreate().
+** \param     region Pointer to a previously created heap region to take the memory from.
+** \param     minBlockSize Size in bytes of the blocks of the lowest order. Must be a power
+**            of two and at least large enough to hold two pointers. All blocks are
+**            aligned to this size.
+** \param     numOrders Number of orders. The total size of the memory that the buddy
+**            allocator manages is (minBlockSize << (numOrders - 1)).
+** \return    Pointer to the newly created buddy allocator if successful, NULL otherwise.
+**
+****************************************************************************************/
+tTbxBuddy * TbxBuddyCreateFrom(tTbxHeapRegion * region,
+                               size_t           minBlockSize,
+                               uint8_t          numOrders)
+{
+  tTbxBuddy * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (region != NULL)
+  {
+    /* Create the buddy allocator with memory taken from the heap region. */
+    result = TbxBuddyCreateInternal(region, minBlockSize, numOrders);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBuddyCreateFrom ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes from the buddy allocator. The size is
+**            rounded up to the block size of the smallest order that fits.
+** \param     buddy Pointer to a previously created buddy allocator to operate on.
+** \param     size The number of bytes to allocate.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxBuddyAllocate(tTbxBuddy * buddy,
+                        size_t      size)
+{
+  void        * result = NULL;
+  tBuddyBlock * block;
+  uint8_t       order = 0U;
+  uint8_t       freeOrder;
+  size_t        blockIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buddy != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (buddy != NULL) && (size > 0U) )
+  {
+    /* Determine the smallest order with blocks that fit the desired size. */
+    while ( (order < buddy->numOrders) &&
+            (((size_t)1U << (buddy->minBlockSizeLog2 + order)) < size) )
+    {
+      order++;
+    }
+    /* Only continue if the size can be managed. */
+    if (order < buddy->numOrders)
+    {
+      /* Obtain mutual exclusive access to the buddy allocator. */
+      TbxCriticalSectionEnter();
+      /* Find the lowest order, starting at the desired one, that has a free block. */
+      freeOrder = order;
+      while ( (freeOrder < buddy->numOrders) && (buddy->freeLists[freeOrder] == NULL) )
+      {
+        freeOrder++;
+      }
+      /* Only continue if a free block was found. */
+      if (freeOrder < buddy->numOrders)
+      {
+        /* Take the block out of its free list. */
+        block = (tBuddyBlock *)buddy->freeLists[freeOrder];
+        TbxBuddyBlockRemove(buddy, freeOrder, block);
+        blockIdx = (size_t)((uint8_t *)(void *)block - buddy->memPtr) >> \
+                   (buddy->minBlockSizeLog2 + freeOrder);
+        /* Split the block until it has the desired order. The first half is split further
+         * and its buddy is added to the free list of the lower order.
+         */
+        while (freeOrder > order)
+        {
+          TbxBuddyBitSet(buddy->splitBitmap,
+                         TbxBuddySplitBitIdx(buddy, freeOrder, blockIdx), 1U);
+          freeOrder--;
+          blockIdx <<= 1U;
+          TbxBuddyBlockInsert(buddy, freeOrder, blockIdx + 1U);
+        }
+        /* Flag that an allocated block starts here, needed to verify its release. */
+        TbxBuddyBitSet(buddy->usedBitmap, blockIdx << order, 1U);
+        /* Update the result. */
+        result = block;
+      }
+      /* Release mutual exclusive access to the buddy allocator. */
+      TbxCriticalSectionExit();
+    }
+  }
+
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxBuddyAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases previously allocated memory, such that it can be allocated again.
+**            The block is merged with its buddy for as long as the buddy is free as well.
+** \param     buddy Pointer to a previously created buddy allocator to operate on.
+** \param     memPtr Pointer to the memory to release. It must have been allocated with
+**            TbxBuddyAllocate() from the same buddy allocator.
+**
+****************************************************************************************/
+void TbxBuddyRelease(tTbxBuddy * buddy,
+                     void      * memPtr)
+{
+  uint8_t * blockPtr = (uint8_t *)memPtr;
+  size_t    blockIdx;
+  size_t    memSize;
+  uint8_t   order = 0U;
+  uint8_t   topOrder;
+  uint8_t   merging = TBX_TRUE;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buddy != NULL);
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (buddy != NULL) && (memPtr != NULL) )
+  {
+    /* Determine the highest order and the total size of the managed memory. */
+    topOrder = (uint8_t)(buddy->numOrders - 1U);
+    memSize = (size_t)1U << (buddy->minBlockSizeLog2 + topOrder);
+    /* Verify that the memory belongs to this buddy allocator. */
+    TBX_ASSERT(blockPtr >= buddy->memPtr);
+    TBX_ASSERT(blockPtr < &buddy->memPtr[memSize]);
+    /* Only continue if the memory belongs to this buddy allocator. */
+    if ( (blockPtr >= buddy->memPtr) && (blockPtr < &buddy->memPtr[memSize]) )
+    {
+      /* Determine the index of the block of the lowest order, where the memory starts. */
+      blockIdx = (size_t)(blockPtr - buddy->memPtr) >> buddy->minBlockSizeLog2;
+      /* Obtain mutual exclusive access to the buddy allocator. */
+      TbxCriticalSectionEnter();
+      /* Releasing memory that is not the start of an allocated block, is not allowed. This
+       * also catches releasing the same memory twice.
+       */
+      TBX_ASSERT(blockPtr == (uint8_t *)TbxBuddyBlockGet(buddy, 0U, blockIdx));
+      TBX_ASSERT(TbxBuddyBitGet(buddy->usedBitmap, blockIdx) != 0U);
+      /* Only continue if the memory is the start of an allocated block. */
+      if ( (blockPtr == (uint8_t *)TbxBuddyBlockGet(buddy, 0U, blockIdx)) &&
+           (TbxBuddyBitGet(buddy->usedBitmap, blockIdx) != 0U) )
+      {
+        /* Flag that the allocated block no longer starts here. */
+        TbxBuddyBitSet(buddy->usedBitmap, blockIdx, 0U);
+        /* Determine the order of the block. Its parent block is the lowest one that is
+         * split, because blocks inside an allocated block are never split.
+         */
+        while ( (order < topOrder) &&
+                (TbxBuddyBitGet(buddy->splitBitmap, TbxBuddySplitBitIdx(buddy, order + 1U,
+                                blockIdx >> (order + 1U))) == 0U) )
+        {
+          order++;
+        }
+        blockIdx >>= order;
+        /* Merge the block with its buddy for as long as the buddy is free as well. */
+        while ( (order < topOrder) && (merging == TBX_TRUE) )
+        {
+          /* The block itself is not yet free, so the pair bit is only set if its buddy
+           * is free.
+           */
+          if (TbxBuddyBitGet(buddy->pairBitmap,
+                             TbxBuddyPairBitIdx(buddy, order, blockIdx)) == 0U)
+          {
+            /* The buddy is still in use, so merging stops here. */
+            merging = TBX_FALSE;
+          }
+          else
+          {
+            /* Take the buddy out of its free list and merge it into the parent block,
+             * which is then no longer split.
+             */
+            TbxBuddyBlockRemove(buddy, order, TbxBuddyBlockGet(buddy, order,
+                                                               blockIdx ^ 1U));
+            order++;
+            blockIdx >>= 1U;
+            TbxBuddyBitSet(buddy->splitBitmap,
+                           TbxBuddySplitBitIdx(buddy, order, blockIdx), 0U);
+          }
+        }
+        /* Add the resulting block to its free list. */
+        TbxBuddyBlockInsert(buddy, order, blockIdx);
+      }
+      /* Release mutual exclusive access to the buddy allocator. */
+      TbxCriticalSectionExit();
+    }
+  }
+} /*** end of TbxBuddyRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of bytes in the free blocks of the buddy allocator.
+**            Note that due to fragmentation, the largest possible allocation can be
+**            smaller than this.
+** \param     buddy Pointer to a previously created buddy allocator to operate on.
+** \return    Number of free bytes in the buddy allocator.
+**
+****************************************************************************************/
+size_t TbxBuddyGetFree(tTbxBuddy const * buddy)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(buddy != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (buddy != NULL)
+  {
+    /* Obtain mutual exclusive access to the buddy allocator. */
+    TbxCriticalSectionEnter();
+    /* Read out the number of free bytes. */
+    result = buddy->freeBytes;
+    /* Release mutual exclusive access to the buddy allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBuddyGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new buddy allocator. This function implements TbxBuddyCreate()
+**            and TbxBuddyCreateFrom().
+** \param     region Pointer to the heap region to take the memory from, or NULL to take
+**            it from the default heap.
+** \param     minBlockSize Size in bytes of the blocks of the lowest order.
+** \param     numOrders Number of orders.
+** \return    Pointer to the newly created buddy allocator if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxBuddy * TbxBuddyCreateInternal(tTbxHeapRegion * region,
+                                          size_t           minBlockSize,
+                                          uint8_t          numOrders)
+{
+  tTbxBuddy * result = NULL;
+  tTbxBuddy * buddy = NULL;
+  uint8_t   * memPtr;
+  uint8_t     minBlockSizeLog2 = 0U;
+  size_t      blockCount;
+  size_t      bitmapSize;
+  size_t      usedBitmapSize;
+  size_t      memSize;
+  size_t      adminSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(minBlockSize >= sizeof(tBuddyBlock));
+  TBX_ASSERT((minBlockSize & (minBlockSize - 1U)) == 0U);
+  TBX_ASSERT(numOrders > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (minBlockSize >= sizeof(tBuddyBlock)) && (numOrders > 0U) &&
+       ((minBlockSize & (minBlockSize - 1U)) == 0U) )
+  {
+    /* Determine the log2 of the minimum block size. */
+    while (((size_t)1U << minBlockSizeLog2) < minBlockSize)
+    {
+      minBlockSizeLog2++;
+    }
+    /* Verify that the total size of the memory can be represented. */
+    TBX_ASSERT((minBlockSizeLog2 + numOrders) < (sizeof(size_t) * 8U));
+    /* Only continue if the total size of the memory can be represented. */
+    if ((minBlockSizeLog2 + numOrders) < (sizeof(size_t) * 8U))
+    {
+      /* Determine the number of blocks of the lowest order. */
+      blockCount = (size_t)1U << (numOrders - 1U);
+      /* The pair and split bitmaps both need one bit less than this. */
+      bitmapSize = (blockCount + 6U) / 8U;
+      usedBitmapSize = (blockCount + 7U) / 8U;
+      /* Create the memory that the buddy allocator manages. This is done first, because
+       * heap memory cannot be released again. Should the administration not fit anymore,
+       * only its smaller allocation is lost.
+       */
+      memSize = minBlockSize << (numOrders - 1U);
+      if (region == NULL)
+      {
+        memPtr = TbxHeapAllocateAligned(memSize, minBlockSize);
+      }
+      else
+      {
+        memPtr = TbxHeapRegionAllocateAligned(region, memSize, minBlockSize);
+      }
+      /* Create the buddy allocator's administration. Its free list heads and bitmaps are
+       * stored right after it.
+       */
+      if (memPtr != NULL)
+      {
+        adminSize = sizeof(tTbxBuddy) + (numOrders * sizeof(void *)) + \
+                    (2U * bitmapSize) + usedBitmapSize;
+        if (region == NULL)
+        {
+          buddy = TbxHeapAllocate(adminSize);
+        }
+        else
+        {
+          buddy = TbxHeapRegionAllocate(region, adminSize);
+        }
+      }
+      /* Only continue if both could be created. */
+      if (buddy != NULL)
+      {
+        /* Initialize the buddy allocator's administration. */
+        buddy->memPtr = memPtr;
+        buddy->freeLists = (void **)(void *)&buddy[1];
+        buddy->pairBitmap = (uint8_t *)(void *)&buddy->freeLists[numOrders];
+        buddy->splitBitmap = &buddy->pairBitmap[bitmapSize];
+        buddy->usedBitmap = &buddy->splitBitmap[bitmapSize];
+        buddy->freeBytes = 0U;
+        buddy->minBlockSizeLog2 = minBlockSizeLog2;
+        buddy->numOrders = numOrders;
+        /* Initially all the free lists are empty. */
+        for (uint8_t order = 0U; order < numOrders; order++)
+        {
+          buddy->freeLists[order] = NULL;
+        }
+        /* Initially no blocks are split or used. */
+        for (size_t byteIdx = 0U; byteIdx < ((2U * bitmapSize) + usedBitmapSize); byteIdx++)
+        {
+          buddy->pairBitmap[byteIdx] = 0U;
+        }
+        /* Add the one block of the highest order, which spans all the memory. */
+        TbxBuddyBlockInsert(buddy, (uint8_t)(numOrders - 1U), 0U);
+        /* Update the result. */
+        result = buddy;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxBuddyCreateInternal ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a bit from a bitmap.
+** \param     bitmap Pointer to the bitmap.
+** \param     bitIdx Index of the bit.
+** \return    The value of the bit, so 0 or 1.
+**
+****************************************************************************************/
+static uint8_t TbxBuddyBitGet(uint8_t const * bitmap,
+                              size_t          bitIdx)
+{
+  /* Extract the bit from the byte that holds it. */
+  return (uint8_t)((bitmap[bitIdx / 8U] >> (bitIdx % 8U)) & 0x01U);
+} /*** end of TbxBuddyBitGet ***/
+
+
+/************************************************************************************//**
+** \brief     Writes a bit in a bitmap.
+** \param     bitmap Pointer to the bitmap.
+** \param     bitIdx Index of the bit.
+** \param     value The new value of the bit, so 0 or 1.
+**
+****************************************************************************************/
+static void TbxBuddyBitSet(uint8_t * bitmap,
+                           size_t    bitIdx,
+                           uint8_t   value)
+{
+  /* Set or clear the bit in the byte that holds it. */
+  if (value != 0U)
+  {
+    bitmap[bitIdx / 8U] |= (uint8_t)(1U << (bitIdx % 8U));
+  }
+  else
+  {
+    bitmap[bitIdx / 8U] &= (uint8_t)~(1U << (bitIdx % 8U));
+  }
+} /*** end of TbxBuddyBitSet ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the index of the bit in the pair bitmap, that belongs to the block
+**            and its buddy. The bits of the lowest order come first, followed by those of
+**            the next order, and so on. Each order has half as many pairs as the previous
+**            one.
+** \param     buddy Pointer to the buddy allocator to operate on.
+** \param     order Order of the block. Must be lower than the highest order.
+** \param     blockIdx Index of the block within its order.
+** \return    Bit index.
+**
+****************************************************************************************/
+static size_t TbxBuddyPairBitIdx(tTbxBuddy const * buddy,
+                                 uint8_t           order,
+                                 size_t            blockIdx)
+{
+  size_t  blockCount = (size_t)1U << (buddy->numOrders - 1U);
+
+  /* Skip the bits of the lower orders and add the index of the pair. */
+  return (blockCount - (blockCount >> order)) + (blockIdx >> 1U);
+} /*** end of TbxBuddyPairBitIdx ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the index of the bit in the split bitmap, that belongs to the
+**            block. The bits of the order above the lowest one come first, followed by
+**            those of the next order, and so on. Each order has half as many blocks as the
+**            previous one.
+** \param     buddy Pointer to the buddy allocator to operate on.
+** \param     order Order of the block. Must be higher than the lowest order.
+** \param     blockIdx Index of the block within its order.
+** \return    Bit index.
+**
+****************************************************************************************/
+static size_t TbxBuddySplitBitIdx(tTbxBuddy const * buddy,
+                                  uint8_t           order,
+                                  size_t            blockIdx)
+{
+  size_t  blockCount = (size_t)1U << (buddy->numOrders - 1U);
+
+  /* Skip the bits of the lower orders and add the index of the block. */
+  return (blockCount - (blockCount >> (order - 1U))) + blockIdx;
+} /*** end of TbxBuddySplitBitIdx ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the start address of a block.
+** \param     buddy Pointer to the buddy allocator to operate on.
+** \param     order Order of the block.
+** \param     blockIdx Index of the block within its order.
+** \return    Pointer to the block.
+**
+****************************************************************************************/
+static tBuddyBlock * TbxBuddyBlockGet(tTbxBuddy const * buddy,
+                                      uint8_t           order,
+                                      size_t            blockIdx)
+{
+  /* Blocks of the same order are located one after the other. */
+  return (tBuddyBlock *)(void *)&buddy->memPtr[blockIdx << (buddy->minBlockSizeLog2 + \
+                                                            order)];
+} /*** end of TbxBuddyBlockGet ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a block to the front of the free list of its order.
+** \param     buddy Pointer to the buddy allocator to operate on.
+** \param     order Order of the block.
+** \param     blockIdx Index of the block within its order.
+**
+****************************************************************************************/
+static void TbxBuddyBlockInsert(tTbxBuddy * buddy,
+                                uint8_t     order,
+                                size_t      blockIdx)
+{
+  tBuddyBlock * block = TbxBuddyBlockGet(buddy, order, blockIdx);
+  tBuddyBlock * headPtr = (tBuddyBlock *)buddy->freeLists[order];
+  size_t        bitIdx;
+
+  /* Link the block at the front of the free list. */
+  block->prevFreePtr = NULL;
+  block->nextFreePtr = headPtr;
+  if (headPtr != NULL)
+  {
+    headPtr->prevFreePtr = block;
+  }
+  buddy->freeLists[order] = block;
+  /* The block became free, so flip the bit of its pair. The block of the highest order
+   * has no buddy.
+   */
+  if (order < (buddy->numOrders - 1U))
+  {
+    bitIdx = TbxBuddyPairBitIdx(buddy, order, blockIdx);
+    TbxBuddyBitSet(buddy->pairBitmap, bitIdx,
+                   TbxBuddyBitGet(buddy->pairBitmap, bitIdx) ^ 0x01U);
+  }
+  /* Update the number of free bytes. */
+  buddy->freeBytes += (size_t)1U << (buddy->minBlockSizeLog2 + order);
+} /*** end of TbxBuddyBlockInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Removes a block from the free list of its order.
+** \param     buddy Pointer to the buddy allocator to operate on.
+** \param     order Order of the block.
+** \param     block Pointer to the block to remove.
+**
+****************************************************************************************/
+static void TbxBuddyBlockRemove(tTbxBuddy   * buddy,
+                                uint8_t       order,
+                                tBuddyBlock * block)
+{
+  size_t bitIdx;
+
+  /* Unlink the block from its neighbors in the free list. */
+  if (block->nextFreePtr != NULL)
+  {
+    block->nextFreePtr->prevFreePtr = block->prevFreePtr;
+  }
+  if (block->prevFreePtr != NULL)
+  {
+    block->prevFreePtr->nextFreePtr = block->nextFreePtr;
+  }
+  /* The block was the head of the free list. */
+  else
+  {
+    buddy->freeLists[order] = block->nextFreePtr;
+  }
+  /* The block is no longer free, so flip the bit of its pair. The block of the highest
+   * order has no buddy.
+   */
+  if (order < (buddy->numOrders - 1U))
+  {
+    bitIdx = TbxBuddyPairBitIdx(buddy, order, (size_t)((uint8_t *)(void *)block - \
+                                buddy->memPtr) >> (buddy->minBlockSizeLog2 + order));
+    TbxBuddyBitSet(buddy->pairBitmap, bitIdx,
+                   TbxBuddyBitGet(buddy->pairBitmap, bitIdx) ^ 0x01U);
+  }
+  /* Update the number of free bytes. */
+  buddy->freeBytes -= (size_t)1U << (buddy->minBlockSizeLog2 + order);
+} /*** end of TbxBuddyBlockRemove ***/
+
+
+/*********************************** end of tbx_buddy.c ********************************/
@@ -0,0 +1,101 @@
+/************************************************************************************//**
+* \file         tbx_buddy.h
+* \brief        Buddy memory allocator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_BUDDY_H
+#define TBX_BUDDY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a buddy allocator. Its pointer serves as the handle to the buddy
+ *         allocator which is obtained after creation of the buddy allocator and which is
+ *         needed in the other functions of this module. Note that its elements should be
+ *         considered private and only be accessed internally by this buddy module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the start of the memory that blocks are taken from. */
+  uint8_t  * memPtr;
+  /** \brief Heads of the free lists, one per order. */
+  void    ** freeLists;
+  /** \brief Bitmap with one bit per pair of buddies, for all orders except the highest
+   *         one. The bit is set if exactly one of the two buddies is free.
+   */
+  uint8_t  * pairBitmap;
+  /** \brief Bitmap with one bit per block, for all orders except the lowest one. The
+   *         bit is set if the block is split into two buddies.
+   */
+  uint8_t  * splitBitmap;
+  /** \brief Bitmap with one bit per block of the lowest order. The bit is set if an
+   *         allocated block starts at this block.
+   */
+  uint8_t  * usedBitmap;
+  /** \brief Total number of bytes in the free blocks. */
+  size_t     freeBytes;
+  /** \brief Log2 of the size of the blocks of the lowest order. */
+  uint8_t    minBlockSizeLog2;
+  /** \brief Number of orders. The highest order has one block that spans all memory. */
+  uint8_t    numOrders;
+} tTbxBuddy;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxBuddy * TbxBuddyCreate    (size_t            minBlockSize,
+                               uint8_t           numOrders);
+
+tTbxBuddy * TbxBuddyCreateFrom(tTbxHeapRegion  * region,
+                               size_t            minBlockSize,
+                               uint8_t           numOrders);
+
+void      * TbxBuddyAllocate  (tTbxBuddy       * buddy,
+                               size_t            size);
+
+void        TbxBuddyRelease   (tTbxBuddy       * buddy,
+                               void            * memPtr);
+
+size_t      TbxBuddyGetFree   (tTbxBuddy const * buddy);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_BUDDY_H */
+/*********************************** end of tbx_buddy.h ********************************/
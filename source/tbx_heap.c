@@ -50,12 +50,198 @@
 #define TBX_CONF_HEAP_SIZE                       (1024U)
 #endif
 
+#ifndef TBX_CONF_HEAP_BUFFER_ALIGNMENT
+/** \brief Configure the alignment in bytes of the heap buffer itself. Setting it to the
+ *         cache line size of the CPU, makes sure that no alignment padding is needed
+ *         for the first cache line aligned allocation. Must be a power of two. Note that
+ *         it is possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_HEAP_BUFFER_ALIGNMENT           (8U)
+#endif
+
+#ifndef TBX_CONF_HEAP_CHUNK_SIZE
+/** \brief Configure the size in bytes of the thread-local heap chunks. When > 0, each
+ *         thread reserves chunks of this size from the heap and serves its smaller
+ *         TbxHeapAllocate() calls from it, without touching any shared state. Only
+ *         available on ports that support thread-local storage. Set to 0 to disable.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_HEAP_CHUNK_SIZE                 (0U)
+#endif
+
+#ifndef TBX_CONF_HEAP_GROW_SIZE
+/** \brief Configure the minimum size in bytes of each region that is added to the heap,
+ *         once the heap buffer of TBX_CONF_HEAP_SIZE bytes is exhausted. The memory for
+ *         these regions is requested from the operating system. Only available on ports
+ *         that support memory mapping. Set to 0 to disable heap growth.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_HEAP_GROW_SIZE                  (0U)
+#endif
+
+#ifndef TBX_CONF_HEAP_GROW_LIMIT
+/** \brief Configure the maximum number of bytes that the heap can grow with, in addition
+ *         to the TBX_CONF_HEAP_SIZE bytes of the heap buffer. Once reached, heap
+ *         allocations fail, just like when heap growth is disabled.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_HEAP_GROW_LIMIT                 (64U * 1024U * 1024U)
+#endif
+
+#ifndef TBX_CONF_HEAP_GROW_HUGE_PAGES
+/** \brief Configure if the regions that are added to the heap, should be backed by huge
+ *         pages. Reduces the number of TLB misses, when accessing large memory pools.
+ *         Set to 1 to enable and 0 to disable.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_HEAP_GROW_HUGE_PAGES            (0U)
+#endif
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+#ifndef TBX_PORT_THREAD_LOCAL
+#error "TBX_CONF_HEAP_CHUNK_SIZE requires a port that supports thread-local storage."
+#endif
+#endif
+
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+#if (TBX_PORT_MEMORY_MAP_SUPPORTED == 0U)
+#error "TBX_CONF_HEAP_GROW_SIZE requires a port that supports memory mapping."
+#endif
+#if (TBX_CONF_HEAP_GROW_LIMIT < TBX_CONF_HEAP_GROW_SIZE)
+#error "TBX_CONF_HEAP_GROW_LIMIT must be at least TBX_CONF_HEAP_GROW_SIZE."
+#endif
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Compiler specific way of aligning the heap buffer. */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define TBX_HEAP_BUFFER_ALIGN          _Alignas(TBX_CONF_HEAP_BUFFER_ALIGNMENT)
+#elif defined(__GNUC__) || defined(__CC_ARM)
+#define TBX_HEAP_BUFFER_ALIGN          __attribute__((aligned(TBX_CONF_HEAP_BUFFER_ALIGNMENT)))
+#else
+#define TBX_HEAP_BUFFER_ALIGN
+#endif
+
+#if (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+/** \brief Allocations larger than this number of bytes bypass the thread-local heap
+ *         chunk, to limit the number of bytes lost at the end of a chunk.
+ */
+#define TBX_HEAP_CHUNK_ALLOC_MAX       (TBX_CONF_HEAP_CHUNK_SIZE / 4U)
+#endif
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+#if defined(__GNUC__)
+/** \brief Obtains the return address of the function that requested the allocation. */
+#define TBX_HEAP_TRACE_CALLER()        (__builtin_return_address(0))
+#else
+/** \brief Return address of the caller is not available on this compiler. */
+#define TBX_HEAP_TRACE_CALLER()        (NULL)
+#endif
+#endif /* (TBX_CONF_HEAP_TRACE_ENABLE > 0U) */
+
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+/** \brief Maximum number of regions that can be added to the heap. Each one is at least
+ *         TBX_CONF_HEAP_GROW_SIZE bytes.
+ */
+#define TBX_HEAP_GROW_REGIONS_MAX      (TBX_CONF_HEAP_GROW_LIMIT / TBX_CONF_HEAP_GROW_SIZE)
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void * TbxHeapAllocateDefault       (size_t           size);
+
+static void * TbxHeapRegionAllocateInternal(tTbxHeapRegion * region,
+                                            size_t           size,
+                                            size_t           alignment);
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+static void * TbxHeapGrowAllocate          (size_t           size,
+                                            size_t           alignment);
+#endif
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+static void   TbxHeapTraceRecord           (void     const * memPtr,
+                                            size_t           size,
+                                            uint8_t          tag,
+                                            void     const * callerPtr);
+#endif
+
 
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
-/** \brief Keeps track of how many bytes have already been allocated on the heap. */
-static size_t tbxHeapAllocated = 0U;
+/* cppcheck-suppress [unassignedVariable,unmatchedSuppression] 
+ * The actual heap buffer. Whenever memory needs to be dynamically allocated, it will
+ * be taken from this buffer. As such, it is okay to not be initialized and therefore
+ * the warning about no value being assigned to this variable can be ignored.
+ */
+static TBX_HEAP_BUFFER_ALIGN uint8_t tbxHeapBuffer[TBX_CONF_HEAP_SIZE];
+
+/** \brief The default heap region that manages the heap buffer. It is the region that
+ *         functions TbxHeapAllocate(), TbxHeapAllocateAligned() and TbxHeapGetFree()
+ *         operate on.
+ */
+static tTbxHeapRegion tbxHeapRegion = 
+{
+  .memPtr = tbxHeapBuffer,
+  .size = TBX_CONF_HEAP_SIZE,
+  .allocated = 0U
+};
+
+#if (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+/** \brief Pointer to the start of the still free part of the calling thread's heap
+ *         chunk.
+ */
+static TBX_PORT_THREAD_LOCAL uint8_t * tbxHeapChunkPtr = NULL;
+
+/** \brief Number of bytes that are still free in the calling thread's heap chunk. */
+static TBX_PORT_THREAD_LOCAL size_t    tbxHeapChunkFree = 0U;
+#endif
+
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+/** \brief The regions that were added to the heap, once the heap buffer was exhausted.
+ *         Only the most recently added one is used for new allocations.
+ */
+static tTbxHeapRegion  * tbxHeapGrowRegions[TBX_HEAP_GROW_REGIONS_MAX];
+
+/** \brief Number of regions that were added to the heap so far. */
+static size_t volatile   tbxHeapGrowCount = 0U;
+
+/** \brief Total number of bytes that were added to the heap so far. */
+static size_t            tbxHeapGrowMapped = 0U;
+#endif
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+/** \brief Ring buffer with the most recent heap allocations. */
+static tTbxHeapTraceEntry            tbxHeapTraceLog[TBX_CONF_HEAP_TRACE_LOG_SIZE];
+
+/** \brief Index into the allocation log, where the next entry will be stored. */
+static size_t                        tbxHeapTraceLogIdx = 0U;
+
+/** \brief Number of valid entries in the allocation log. */
+static size_t                        tbxHeapTraceLogCount = 0U;
+
+/** \brief Total number of bytes that were successfully allocated, per allocation tag. */
+static size_t                        tbxHeapTraceTagTotals[TBX_CONF_HEAP_TRACE_TAGS];
+
+/** \brief High-water mark of the number of bytes in use on the heap. */
+static size_t                        tbxHeapTracePeak = 0U;
+
+/** \brief Pointer to the application provided timestamp handler function. */
+static tTbxHeapTraceTimestampHandler tbxHeapTraceTimestampHandler = NULL;
+#endif
 
 
 /************************************************************************************//**
@@ -69,62 +255,850 @@ static size_t tbxHeapAllocated = 0U;
 ****************************************************************************************/
 void * TbxHeapAllocate(size_t size)
 {
-  /* cppcheck-suppress [unassignedVariable,unmatchedSuppression] 
-   * The actual heap buffer. Whenever memory needs to be dynamically allocated, it will
-   * be taken from this buffer. As such, it is okay to not be initialized and therefore
-   * the warning about no value being assigned to this variable can be ignored.
-   */
-  static uint8_t   tbxHeapBuffer[TBX_CONF_HEAP_SIZE];
-  void           * result = NULL;
+  void * result;
+
+  /* Perform the allocation. */
+  result = TbxHeapAllocateDefault(size);
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+  /* Record the allocation in the heap trace. */
+  TbxHeapTraceRecord(result, size, TBX_HEAP_TAG_NONE, TBX_HEAP_TRACE_CALLER());
+#endif
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes on the heap, just like
+**            TbxHeapAllocate(). Additionally, the allocation is labeled with a tag. With
+**            heap instrumentation enabled, this makes it possible to find out how many
+**            bytes each subsystem of the software program allocated. Without heap
+**            instrumentation, the tag is ignored.
+** \param     size The number of bytes to allocate on the heap.
+** \param     tag Allocation tag in the range 0 to (TBX_CONF_HEAP_TRACE_TAGS - 1), for
+**            example one per subsystem.
+** \return    Pointer to the start of the newly allocated heap memory if successful,
+**            NULL otherwise.
+**
+****************************************************************************************/
+void * TbxHeapAllocateTagged(size_t  size,
+                             uint8_t tag)
+{
+  void * result;
 
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
   /* Verify parameter. */
+  TBX_ASSERT(tag < TBX_CONF_HEAP_TRACE_TAGS);
+#else
+  /* The tag is only needed for the heap instrumentation. */
+  TBX_UNUSED_ARG(tag);
+#endif
+  /* Perform the allocation. */
+  result = TbxHeapAllocateDefault(size);
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+  /* Record the allocation in the heap trace. */
+  TbxHeapTraceRecord(result, size, tag, TBX_HEAP_TRACE_CALLER());
+#endif
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapAllocateTagged ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes on the heap, such that the start
+**            address of the allocated memory is aligned to the specified boundary.
+**            Handy for DMA descriptors and buffers that should be placed on their own
+**            cache line(s). Any padding bytes needed for the alignment are taken from
+**            the heap as well. Just like with TbxHeapAllocate(), free-ing of allocated
+**            memory is not supported.
+** \param     size The number of bytes to allocate on the heap.
+** \param     alignment Desired alignment of the start address in bytes. Must be a power
+**            of two, for example 16, 32 or 64.
+** \return    Pointer to the start of the newly allocated heap memory if successful,
+**            NULL otherwise.
+**
+****************************************************************************************/
+void * TbxHeapAllocateAligned(size_t size,
+                              size_t alignment)
+{
+  void * result;
+
+  /* Allocate from the default heap region. */
+  result = TbxHeapRegionAllocateAligned(&tbxHeapRegion, size, alignment);
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+  /* Record the allocation in the heap trace. */
+  TbxHeapTraceRecord(result, size, TBX_HEAP_TAG_NONE, TBX_HEAP_TRACE_CALLER());
+#endif
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapAllocateAligned ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the current amount of bytes that are still available on the heap.
+**            When thread-local heap chunks are enabled, this is the number of bytes that
+**            the calling thread can still allocate. So the free bytes in the shared
+**            heap, plus the free bytes in its own heap chunk. The free bytes in the heap
+**            chunks of other threads are not included. Note that up to
+**            TBX_CONF_HEAP_CHUNK_SIZE bytes per thread can remain stranded in a chunk,
+**            once its thread reserves a new chunk or terminates. When heap growth is
+**            enabled, the free bytes of the most recently added region and the number
+**            of bytes that the heap can still grow with, are included as well. These
+**            bytes are spread over separate regions, each with its own administration
+**            and alignment overhead. The value is then an upper bound, so a single
+**            allocation of this size does not necessarily succeed.
+** \return    Number of free bytes on the heap.
+**
+****************************************************************************************/
+size_t TbxHeapGetFree(void)
+{
+  size_t result;
+
+  /* Obtain the free bytes of the default heap region. */
+  result = TbxHeapRegionGetFree(&tbxHeapRegion);
+#if (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+  /* Add the free bytes of the calling thread's heap chunk. */
+  result += tbxHeapChunkFree;
+#endif
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+  /* Obtain mutual exclusive access to the heap growth administration. */
+  TbxCriticalSectionEnter();
+  /* Have regions been added to the heap? */
+  if (tbxHeapGrowCount > 0U)
+  {
+    /* Add the free bytes of the region that is currently used for allocations. */
+    result += TbxHeapRegionGetFree(tbxHeapGrowRegions[tbxHeapGrowCount - 1U]);
+  }
+  /* Add the number of bytes that the heap can still grow with. */
+  result += TBX_CONF_HEAP_GROW_LIMIT - tbxHeapGrowMapped;
+  /* Release mutual exclusive access to the heap growth administration. */
+  TbxCriticalSectionExit();
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new heap region on top of the memory supplied by the caller. This
+**            makes it possible to allocate memory from a specific memory area, for
+**            example from a fast tightly coupled SRAM bank, independent from the
+**            default heap. Each heap region has its own allocation counter, so 
+**            allocations from different regions do not influence each other. The heap
+**            region's administration is stored at the start of the supplied memory.
+**            Just like with the default heap, free-ing of allocated memory is not
+**            supported.
+** \param     memPtr Pointer to the start of the memory that the heap region manages.
+** \param     size Total size in bytes of the memory that the heap region manages.
+** \return    Pointer to the newly created heap region if successful, NULL otherwise.
+**            Make sure to store the pointer because it serves as a handle to the heap
+**            region, which is needed when calling the other heap region functions.
+**
+****************************************************************************************/
+tTbxHeapRegion * TbxHeapRegionCreate(void   * memPtr,
+                                     size_t   size)
+{
+  tTbxHeapRegion * result = NULL;
+  size_t           padding;
+
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (size > 0U) )
+  {
+    /* Determine how many padding bytes are needed to align the region's administration
+     * to the address size.
+     */
+    padding = (sizeof(void *) - ((size_t)(uintptr_t)memPtr & (sizeof(void *) - 1U))) & \
+              (sizeof(void *) - 1U);
+    /* Only continue if the memory is large enough to hold the region's administration
+     * and at least one allocation.
+     */
+    if ( (size > padding) && 
+         ((size - padding) > (sizeof(tTbxHeapRegion) + sizeof(void *))) )
+    {
+      /* Place the region's administration at the start of the memory. */
+      uint8_t * regionMemPtr = memPtr;
+      result = (tTbxHeapRegion *)(void *)&regionMemPtr[padding];
+      /* The rest of the memory can be used for allocations. Only whole multiples of
+       * the address size, because that is the granularity for allocations.
+       */
+      result->memPtr = &regionMemPtr[padding + sizeof(tTbxHeapRegion)];
+      result->size = (size - padding - sizeof(tTbxHeapRegion)) & ~(sizeof(void *) - 1U);
+      result->allocated = 0U;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapRegionCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes from the heap region. It works the
+**            same as TbxHeapAllocate(), with the difference that the memory is taken from
+**            the specified heap region, instead of from the default heap.
+** \param     region Pointer to a previously created heap region to operate on.
+** \param     size The number of bytes to allocate from the heap region.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxHeapRegionAllocate(tTbxHeapRegion * region,
+                             size_t           size)
+{
+  void * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (region != NULL) && (size > 0U) )
+  {
+    /* Perform the allocation, aligned to the address size to make it work on all
+     * targets.
+     */
+    result = TbxHeapRegionAllocateInternal(region, size, sizeof(void *));
+  }
+
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapRegionAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes from the heap region, such that the
+**            start address of the allocated memory is aligned to the specified boundary.
+**            It works the same as TbxHeapAllocateAligned(), with the difference that the
+**            memory is taken from the specified heap region, instead of from the default
+**            heap.
+** \param     region Pointer to a previously created heap region to operate on.
+** \param     size The number of bytes to allocate from the heap region.
+** \param     alignment Desired alignment of the start address in bytes. Must be a power
+**            of two, for example 16, 32 or 64.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxHeapRegionAllocateAligned(tTbxHeapRegion * region,
+                                    size_t           size,
+                                    size_t           alignment)
+{
+  void   * result = NULL;
+  size_t   alignmentWanted = alignment;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
   TBX_ASSERT(size > 0U);
+  TBX_ASSERT(alignment > 0U);
+  TBX_ASSERT((alignment & (alignment - 1U)) == 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (region != NULL) && (size > 0U) && (alignment > 0U) && 
+       ((alignment & (alignment - 1U)) == 0U) )
+  {
+    /* Never align to less than the address size. */
+    if (alignmentWanted < sizeof(void *))
+    {
+      alignmentWanted = sizeof(void *);
+    }
+    /* Perform the allocation. */
+    result = TbxHeapRegionAllocateInternal(region, size, alignmentWanted);
+  }
+
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapRegionAllocateAligned ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the current amount of bytes that are still available in the heap
+**            region.
+** \param     region Pointer to a previously created heap region to operate on.
+** \return    Number of free bytes in the heap region.
+**
+****************************************************************************************/
+size_t TbxHeapRegionGetFree(tTbxHeapRegion const * region)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (region != NULL)
+  {
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    /* Determine the number of still available bytes in the heap region. A plain atomic
+     * read of its allocation counter is all that is needed for this.
+     */
+    result = region->size - TbxPortAtomicLoad(&region->allocated);
+#else
+    /* Obtain mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionEnter();
+    /* Determine the number of still available bytes in the heap region. */
+    result = region->size - region->allocated;
+    /* Release mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapRegionGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Marks the current allocation position of the heap region. A later call to
+**            TbxHeapRegionRewind() with this mark, releases everything that was
+**            allocated from the heap region after this function call, all at once.
+**            This turns the heap region into a scoped arena, for example for temporary
+**            working buffers during the processing of a request. Marks can be nested,
+**            as long as they are rewound in the reverse order that they were made.
+** \param     region Pointer to a previously created heap region to operate on.
+** \return    The mark that represents the current allocation position of the heap
+**            region.
+**
+****************************************************************************************/
+size_t TbxHeapRegionMark(tTbxHeapRegion const * region)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (region != NULL)
+  {
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    /* The mark is simply the current value of the allocation counter. */
+    result = TbxPortAtomicLoad(&region->allocated);
+#else
+    /* Obtain mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionEnter();
+    /* The mark is simply the current value of the allocation counter. */
+    result = region->allocated;
+    /* Release mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapRegionMark ***/
+
+
+/************************************************************************************//**
+** \brief     Rewinds the allocation position of the heap region to a mark that was
+**            previously obtained with TbxHeapRegionMark(). All memory that was allocated
+**            from the heap region after the mark was made is released at once and can
+**            be allocated again. It is the caller's responsibility to no longer access
+**            this memory afterwards. Rewinding to a mark also discards all marks that
+**            were made after it.
+** \param     region Pointer to a previously created heap region to operate on.
+** \param     mark The mark to rewind to.
+**
+****************************************************************************************/
+void TbxHeapRegionRewind(tTbxHeapRegion * region,
+                         size_t           mark)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (region != NULL)
+  {
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    size_t  allocated;
+    uint8_t updated = TBX_FALSE;
+
+    do
+    {
+      /* Take a snapshot of the allocation counter. */
+      allocated = TbxPortAtomicLoad(&region->allocated);
+      /* A mark can only rewind, so it cannot be past the allocation counter. */
+      TBX_ASSERT(mark <= allocated);
+      /* Is the mark not valid? */
+      if (mark > allocated)
+      {
+        /* Invalid mark so stop trying. */
+        break;
+      }
+      /* Attempt to rewind the allocation counter to the mark. */
+      updated = TbxPortAtomicCompareExchange(&region->allocated, allocated, mark);
+    }
+    while (updated == TBX_FALSE);
+#else
+    /* Obtain mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionEnter();
+    /* A mark can only rewind, so it cannot be past the allocation counter. */
+    TBX_ASSERT(mark <= region->allocated);
+    /* Only continue if the mark is valid. */
+    if (mark <= region->allocated)
+    {
+      /* Rewind the allocation counter to the mark. */
+      region->allocated = mark;
+    }
+    /* Release mutual exclusive access to the region's allocation counter. */
+    TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+  }
+} /*** end of TbxHeapRegionRewind ***/
+
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Registers the function that provides the timestamps for the allocation log.
+**            Without it, all timestamps in the allocation log are zero.
+** \param     handler Pointer to the application specific timestamp handler.
+**
+****************************************************************************************/
+void TbxHeapTraceSetTimestampHandler(tTbxHeapTraceTimestampHandler handler)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(handler != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (handler != NULL)
+  {
+    /* Store the pointer to the application specific timestamp handler. */
+    tbxHeapTraceTimestampHandler = handler;
+  }
+} /*** end of TbxHeapTraceSetTimestampHandler ***/
+
+
+/************************************************************************************//**
+** \brief     Copies the entries of the allocation log to the specified array. The oldest
+**            entry is copied first. Once the allocation log is full, the oldest entry is
+**            overwritten with each new allocation.
+** \param     entries Pointer to the array to copy the entries to.
+** \param     maxEntries Maximum number of entries that fit in the array.
+** \return    The number of entries that were copied.
+**
+****************************************************************************************/
+size_t TbxHeapTraceGetLog(tTbxHeapTraceEntry * entries,
+                          size_t               maxEntries)
+{
+  size_t result = 0U;
+  size_t logIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT(entries != NULL);
+  TBX_ASSERT(maxEntries > 0U);
 
   /* Only continue if the parameters are valid. */
+  if ( (entries != NULL) && (maxEntries > 0U) )
+  {
+    /* Obtain mutual exclusive access to the heap trace. */
+    TbxCriticalSectionEnter();
+    /* Determine the index of the oldest entry in the allocation log. */
+    logIdx = (tbxHeapTraceLogIdx + TBX_CONF_HEAP_TRACE_LOG_SIZE - tbxHeapTraceLogCount) %
+             TBX_CONF_HEAP_TRACE_LOG_SIZE;
+    /* Copy the entries, oldest first. */
+    while ( (result < tbxHeapTraceLogCount) && (result < maxEntries) )
+    {
+      entries[result] = tbxHeapTraceLog[logIdx];
+      logIdx = (logIdx + 1U) % TBX_CONF_HEAP_TRACE_LOG_SIZE;
+      result++;
+    }
+    /* Release mutual exclusive access to the heap trace. */
+    TbxCriticalSectionExit();
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapTraceGetLog ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of bytes that were successfully allocated on the
+**            heap with the specified allocation tag. Allocations performed with
+**            TbxHeapAllocate() and TbxHeapAllocateAligned() are accounted to tag
+**            TBX_HEAP_TAG_NONE.
+** \param     tag Allocation tag in the range 0 to (TBX_CONF_HEAP_TRACE_TAGS - 1).
+** \return    Total number of bytes allocated with the tag.
+**
+****************************************************************************************/
+size_t TbxHeapTraceGetTagTotal(uint8_t tag)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(tag < TBX_CONF_HEAP_TRACE_TAGS);
+
+  /* Only continue if the parameter is valid. */
+  if (tag < TBX_CONF_HEAP_TRACE_TAGS)
+  {
+    /* Obtain mutual exclusive access to the heap trace. */
+    TbxCriticalSectionEnter();
+    /* Read out the total of this tag. */
+    result = tbxHeapTraceTagTotals[tag];
+    /* Release mutual exclusive access to the heap trace. */
+    TbxCriticalSectionExit();
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapTraceGetTagTotal ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the high-water mark of the number of bytes in use on the heap. This
+**            includes the padding bytes and thread-local heap chunks. It is the value to
+**            base the TBX_CONF_HEAP_SIZE configuration on.
+** \return    High-water mark of the heap usage in bytes.
+**
+****************************************************************************************/
+size_t TbxHeapTraceGetPeak(void)
+{
+  size_t result;
+
+  /* Obtain mutual exclusive access to the heap trace. */
+  TbxCriticalSectionEnter();
+  /* Read out the high-water mark. */
+  result = tbxHeapTracePeak;
+  /* Release mutual exclusive access to the heap trace. */
+  TbxCriticalSectionExit();
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapTraceGetPeak ***/
+#endif /* (TBX_CONF_HEAP_TRACE_ENABLE > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Performs the actual allocation of memory from the default heap. When
+**            enabled, small allocations are served from the calling thread's heap chunk.
+** \param     size The number of bytes to allocate on the heap.
+** \return    Pointer to the start of the newly allocated heap memory if successful,
+**            NULL otherwise.
+**
+****************************************************************************************/
+static void * TbxHeapAllocateDefault(size_t size)
+{
+#if (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+  void * result = NULL;
+
+  /* Verify parameter. */
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameter is valid. */
   if (size > 0U)
   {
     /* Align the desired size to the address size to make it work on all targets. */
     size_t sizeWanted = (size + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U);
-    /* Obtain mutual exclusive access to tbxHeapAllocated. */
-    TbxCriticalSectionEnter();
-      /* Determine the number of still available bytes in the heap buffer. */
-    size_t sizeAvailable = TBX_CONF_HEAP_SIZE - tbxHeapAllocated;
-    /* Is there enough space left on the heap for this allocation request? */
-    if (sizeAvailable >= sizeWanted)
+    /* Does it not fit in the calling thread's heap chunk? */
+    if (sizeWanted > tbxHeapChunkFree)
     {
-      /* Set the address for the newly allocated memory. */
-      result = &tbxHeapBuffer[tbxHeapAllocated];
-      /* Perform the actual allocation by incrementing the counter. */
-      tbxHeapAllocated += sizeWanted;
+      /* Is this a small enough allocation to warrant reserving a new heap chunk? */
+      if (sizeWanted <= TBX_HEAP_CHUNK_ALLOC_MAX)
+      {
+        /* Reserve a new heap chunk for the calling thread. Whatever was still free in
+         * its previous heap chunk is lost, which is at most TBX_HEAP_CHUNK_ALLOC_MAX
+         * bytes.
+         */
+        uint8_t * chunkPtr = TbxHeapRegionAllocate(&tbxHeapRegion,
+                                                   TBX_CONF_HEAP_CHUNK_SIZE);
+        /* Only switch to the new heap chunk if it could be reserved. */
+        if (chunkPtr != NULL)
+        {
+          tbxHeapChunkPtr = chunkPtr;
+          tbxHeapChunkFree = TBX_CONF_HEAP_CHUNK_SIZE;
+        }
+      }
+    }
+    /* Does it fit in the calling thread's heap chunk? */
+    if (sizeWanted <= tbxHeapChunkFree)
+    {
+      /* Allocate from the heap chunk, without the need to access any shared data. */
+      result = tbxHeapChunkPtr;
+      tbxHeapChunkPtr = &tbxHeapChunkPtr[sizeWanted];
+      tbxHeapChunkFree -= sizeWanted;
+    }
+    /* Allocation not possible from a heap chunk. */
+    else
+    {
+      /* Allocate directly from the default heap region instead. */
+      result = TbxHeapRegionAllocate(&tbxHeapRegion, size);
     }
-    /* Release mutual exclusive access to tbxHeapAllocated. */
-    TbxCriticalSectionExit();
   }
 
   /* Return the address of the allocated memory to the caller. */
   return result;
-} /*** end of TbxHeapAllocate ***/
+#else
+  /* Allocate from the default heap region. */
+  return TbxHeapRegionAllocate(&tbxHeapRegion, size);
+#endif /* (TBX_CONF_HEAP_CHUNK_SIZE > 0U) */
+} /*** end of TbxHeapAllocateDefault ***/
 
 
 /************************************************************************************//**
-** \brief     Obtains the current amount of bytes that are still available on the heap.
-** \return    Number of free bytes on the heap.
+** \brief     Performs the actual allocation of memory from a heap region. It starts by
+**            inserting padding bytes, such that the start address of the allocated
+**            memory is aligned to the specified boundary. 
+** \param     region Pointer to the heap region to operate on.
+** \param     size The number of bytes to allocate from the heap region.
+** \param     alignment Desired alignment of the start address in bytes. Must be a power
+**            of two and at least the address size.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
 **
 ****************************************************************************************/
-size_t TbxHeapGetFree(void)
+static void * TbxHeapRegionAllocateInternal(tTbxHeapRegion * region,
+                                            size_t           size,
+                                            size_t           alignment)
 {
-  size_t result;
+  void   * result = NULL;
+  size_t   allocated;
+  size_t   padding;
+
+  /* Align the desired size to the address size to make it work on all targets. */
+  size_t sizeWanted = (size + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U);
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  uint8_t updated = TBX_FALSE;
+
+  /* Lock-free allocation. Keep trying to move the allocation counter forward, until no
+   * other thread changed it in the meantime, or until the heap region is too full.
+   */
+  do
+  {
+    /* Take a snapshot of the allocation counter. */
+    allocated = TbxPortAtomicLoad(&region->allocated);
+    /* Determine how many padding bytes are needed to align the start address. */
+    padding = (alignment - ((size_t)(uintptr_t)&region->memPtr[allocated] & \
+                            (alignment - 1U))) & (alignment - 1U);
+    /* Is there not enough space left in the heap region for this allocation request? */
+    if ( (padding > (region->size - allocated)) ||
+         ((region->size - allocated - padding) < sizeWanted) )
+    {
+      /* Not enough space so stop trying. */
+      break;
+    }
+    /* Attempt to perform the actual allocation by incrementing the counter. */
+    updated = TbxPortAtomicCompareExchange(&region->allocated, allocated,
+                                           allocated + padding + sizeWanted);
+  }
+  while (updated == TBX_FALSE);
 
-  /* Obtain mutual exclusive access to tbxHeapAllocated. */
+  /* Was the allocation successful? */
+  if (updated == TBX_TRUE)
+  {
+    /* Set the address for the newly allocated memory. */
+    result = &region->memPtr[allocated + padding];
+  }
+#else
+  /* Obtain mutual exclusive access to the region's allocation counter. */
   TbxCriticalSectionEnter();
-  /* Determine the number of still available bytes in the heap buffer. */
-  result = TBX_CONF_HEAP_SIZE - tbxHeapAllocated;
-  /* Release mutual exclusive access to tbxHeapAllocated. */
+  allocated = region->allocated;
+  /* Determine how many padding bytes are needed to align the start address. */
+  padding = (alignment - ((size_t)(uintptr_t)&region->memPtr[allocated] & \
+                          (alignment - 1U))) & (alignment - 1U);
+  /* Is there enough space left in the heap region for this allocation request? */
+  if ( (padding <= (region->size - allocated)) &&
+       ((region->size - allocated - padding) >= sizeWanted) )
+  {
+    /* Set the address for the newly allocated memory. */
+    result = &region->memPtr[allocated + padding];
+    /* Perform the actual allocation by incrementing the counter. */
+    region->allocated = allocated + padding + sizeWanted;
+  }
+  /* Release mutual exclusive access to the region's allocation counter. */
   TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+  /* Was the default heap region too full for this allocation request? */
+  if ( (result == NULL) && (region == &tbxHeapRegion) )
+  {
+    /* Allocate from the regions that are added to the heap instead. */
+    result = TbxHeapGrowAllocate(size, alignment);
+  }
+#endif
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxHeapGetFree ***/
+} /*** end of TbxHeapRegionAllocateInternal ***/
+
+
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Allocates memory from the regions that are added to the heap, once the heap
+**            buffer is exhausted. Allocations are taken from the most recently added
+**            region. If that one is too full, a new region of at least
+**            TBX_CONF_HEAP_GROW_SIZE bytes is requested from the operating system, as
+**            long as the total stays within TBX_CONF_HEAP_GROW_LIMIT bytes. The free
+**            bytes that are left in the previous region are not used anymore.
+** \param     size The number of bytes to allocate.
+** \param     alignment Desired alignment of the start address in bytes. Must be a power
+**            of two and at least the address size.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+static void * TbxHeapGrowAllocate(size_t size,
+                                  size_t alignment)
+{
+  void           * result = NULL;
+  void           * memPtr;
+  tTbxHeapRegion * region;
+  size_t           count;
+  size_t           sizeNeeded;
+  size_t           sizeMap;
+
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  /* Take a snapshot of the number of regions that were added to the heap. */
+  count = TbxPortAtomicLoad(&tbxHeapGrowCount);
+  /* Have regions been added to the heap? */
+  if (count > 0U)
+  {
+    /* Attempt a lock-free allocation from the most recently added region. */
+    result = TbxHeapRegionAllocateInternal(tbxHeapGrowRegions[count - 1U], size,
+                                           alignment);
+  }
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+
+  /* Not yet allocated? */
+  if (result == NULL)
+  {
+    /* Obtain mutual exclusive access to the heap growth administration. */
+    TbxCriticalSectionEnter();
+    count = tbxHeapGrowCount;
+    /* Have regions been added to the heap? Note that another thread might have added
+     * a region in the meantime.
+     */
+    if (count > 0U)
+    {
+      /* Attempt to allocate from the most recently added region. */
+      result = TbxHeapRegionAllocateInternal(tbxHeapGrowRegions[count - 1U], size,
+                                             alignment);
+    }
+    /* Still not allocated and can another region be added to the heap? */
+    if ( (result == NULL) && (count < TBX_HEAP_GROW_REGIONS_MAX) )
+    {
+      /* Determine the worst case number of bytes the region needs, to fit this
+       * allocation request. This includes its administration and all padding bytes.
+       */
+      sizeNeeded = size + alignment + sizeof(tTbxHeapRegion) + sizeof(void *);
+      /* Only continue if it did not overflow and stays within the growth limit. */
+      if ( (sizeNeeded > size) &&
+           (sizeNeeded <= (TBX_CONF_HEAP_GROW_LIMIT - tbxHeapGrowMapped)) )
+      {
+        /* Round the size of the region up to a multiple of the growth size. */
+        sizeMap = ((sizeNeeded + (TBX_CONF_HEAP_GROW_SIZE - 1U)) / \
+                   TBX_CONF_HEAP_GROW_SIZE) * TBX_CONF_HEAP_GROW_SIZE;
+        /* Does the rounded up size still stay within the growth limit? */
+        if (sizeMap <= (TBX_CONF_HEAP_GROW_LIMIT - tbxHeapGrowMapped))
+        {
+          /* Request the memory for the new region from the operating system. */
+          memPtr = TbxPortMemoryMap(sizeMap, (TBX_CONF_HEAP_GROW_HUGE_PAGES > 0U) ?
+                                             TBX_TRUE : TBX_FALSE);
+          /* Only continue if the memory could be obtained. */
+          if (memPtr != NULL)
+          {
+            /* Create the new region on top of the memory. Cannot fail, because the
+             * memory is large enough to hold the region's administration.
+             */
+            region = TbxHeapRegionCreate(memPtr, sizeMap);
+            TBX_ASSERT(region != NULL);
+            /* Perform the allocation, before making the region available to other
+             * threads. This way it is guaranteed to succeed.
+             */
+            result = TbxHeapRegionAllocateInternal(region, size, alignment);
+            /* Add the region to the heap. */
+            tbxHeapGrowMapped += sizeMap;
+            tbxHeapGrowRegions[count] = region;
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+            /* Publish the new region to threads that perform a lock-free allocation.
+             * Cannot fail, because the count is only changed inside the critical
+             * section.
+             */
+            (void)TbxPortAtomicCompareExchange(&tbxHeapGrowCount, count, count + 1U);
+#else
+            tbxHeapGrowCount = count + 1U;
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+          }
+        }
+      }
+    }
+    /* Release mutual exclusive access to the heap growth administration. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapGrowAllocate ***/
+#endif /* (TBX_CONF_HEAP_GROW_SIZE > 0U) */
+
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Records a heap allocation in the allocation log and updates the per tag
+**            totals and the high-water mark of the heap usage.
+** \param     memPtr Pointer to the allocated memory or NULL if the allocation failed.
+** \param     size The number of bytes that were requested.
+** \param     tag Allocation tag that was specified with the allocation request.
+** \param     callerPtr Return address of the function that requested the allocation.
+**
+****************************************************************************************/
+static void TbxHeapTraceRecord(void     const * memPtr,
+                               size_t           size,
+                               uint8_t          tag,
+                               void     const * callerPtr)
+{
+  uint32_t timestamp = 0U;
+  size_t   used;
+
+  /* Request the application to provide the timestamp, if it registered a handler for
+   * this.
+   */
+  if (tbxHeapTraceTimestampHandler != NULL)
+  {
+    /* Call the application specific timestamp handler. */
+    timestamp = tbxHeapTraceTimestampHandler();
+  }
+
+  /* Obtain mutual exclusive access to the heap trace. */
+  TbxCriticalSectionEnter();
+  /* Store the allocation in the log, overwriting the oldest entry if it is full. */
+  tbxHeapTraceLog[tbxHeapTraceLogIdx].memPtr = memPtr;
+  tbxHeapTraceLog[tbxHeapTraceLogIdx].callerPtr = callerPtr;
+  tbxHeapTraceLog[tbxHeapTraceLogIdx].size = size;
+  tbxHeapTraceLog[tbxHeapTraceLogIdx].timestamp = timestamp;
+  tbxHeapTraceLog[tbxHeapTraceLogIdx].tag = tag;
+  tbxHeapTraceLogIdx = (tbxHeapTraceLogIdx + 1U) % TBX_CONF_HEAP_TRACE_LOG_SIZE;
+  if (tbxHeapTraceLogCount < TBX_CONF_HEAP_TRACE_LOG_SIZE)
+  {
+    tbxHeapTraceLogCount++;
+  }
+  /* Only successful allocations with a valid tag count towards the tag's total. */
+  if ( (memPtr != NULL) && (tag < TBX_CONF_HEAP_TRACE_TAGS) )
+  {
+    tbxHeapTraceTagTotals[tag] += size;
+  }
+  /* Determine the number of bytes that are currently in use on the heap. Since the heap
+   * never shrinks, this is simply the allocation counter of the heap buffer.
+   */
+  used = TbxHeapRegionMark(&tbxHeapRegion);
+#if (TBX_CONF_HEAP_GROW_SIZE > 0U)
+  /* Have regions been added to the heap? */
+  if (tbxHeapGrowCount > 0U)
+  {
+    /* All added regions count as in use, except for the free bytes in the region that
+     * is currently used for allocations.
+     */
+    used += tbxHeapGrowMapped - \
+            TbxHeapRegionGetFree(tbxHeapGrowRegions[tbxHeapGrowCount - 1U]);
+  }
+#endif
+  /* Update the high-water mark. */
+  if (used > tbxHeapTracePeak)
+  {
+    tbxHeapTracePeak = used;
+  }
+  /* Release mutual exclusive access to the heap trace. */
+  TbxCriticalSectionExit();
+} /*** end of TbxHeapTraceRecord ***/
+#endif /* (TBX_CONF_HEAP_TRACE_ENABLE > 0U) */
 
 
 /*********************************** end of tbx_heap.c *********************************/
@@ -39,12 +39,127 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_HEAP_TRACE_ENABLE
+/** \brief Enable/disable heap instrumentation. When enabled, allocations on the heap are
+ *         recorded in an allocation log, totals are kept per allocation tag and the
+ *         high-water mark of the heap usage is tracked. Note that it is possible to
+ *         override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_HEAP_TRACE_ENABLE               (0U)
+#endif
+
+#ifndef TBX_CONF_HEAP_TRACE_LOG_SIZE
+/** \brief Configure the number of entries in the allocation log. Once full, the oldest
+ *         entry is overwritten. Note that it is possible to override this value by
+ *         adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_HEAP_TRACE_LOG_SIZE             (32U)
+#endif
+
+#ifndef TBX_CONF_HEAP_TRACE_TAGS
+/** \brief Configure the number of allocation tags that totals are kept for. Valid tags
+ *         are in the range 0 to (TBX_CONF_HEAP_TRACE_TAGS - 1). Note that it is possible
+ *         to override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_HEAP_TRACE_TAGS                 (8U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Allocation tag that is used for the allocations that were not tagged. */
+#define TBX_HEAP_TAG_NONE                        (0U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a heap region. Its pointer serves as the handle to the heap region
+ *         which is obtained after creation of the heap region and which is needed in
+ *         the other functions of this module. Note that its elements should be
+ *         considered private and only be accessed internally by this heap module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the start of the memory that allocations are taken from. */
+  uint8_t         * memPtr;
+  /** \brief Total number of bytes that can be allocated from the heap region. */
+  size_t            size;
+  /** \brief Number of bytes that are already allocated from the heap region. */
+  size_t volatile   allocated;
+} tTbxHeapRegion;
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+/** \brief Function type for the handler that provides the timestamps that are stored in
+ *         the allocation log. For example the value of a millisecond counter.
+ */
+typedef uint32_t (* tTbxHeapTraceTimestampHandler)(void);
+
+/** \brief Layout of an entry in the allocation log. */
+typedef struct
+{
+  /** \brief Pointer to the allocated memory or NULL if the allocation failed. */
+  void     const * memPtr;
+  /** \brief Return address of the function that requested the allocation. NULL if not
+   *         supported by the compiler.
+   */
+  void     const * callerPtr;
+  /** \brief Number of bytes that were requested. */
+  size_t           size;
+  /** \brief Timestamp of the allocation, as provided by the timestamp handler. */
+  uint32_t         timestamp;
+  /** \brief Allocation tag that was specified with the allocation request. */
+  uint8_t          tag;
+} tTbxHeapTraceEntry;
+#endif /* (TBX_CONF_HEAP_TRACE_ENABLE > 0U) */
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-void * TbxHeapAllocate(size_t size);
+void           * TbxHeapAllocate             (size_t                 size);
+
+void           * TbxHeapAllocateTagged       (size_t                 size,
+                                              uint8_t                tag);
+
+void           * TbxHeapAllocateAligned      (size_t                 size,
+                                              size_t                 alignment);
+
+size_t           TbxHeapGetFree              (void);
+
+tTbxHeapRegion * TbxHeapRegionCreate         (void                 * memPtr,
+                                              size_t                 size);
+
+void           * TbxHeapRegionAllocate       (tTbxHeapRegion       * region,
+                                              size_t                 size);
+
+void           * TbxHeapRegionAllocateAligned(tTbxHeapRegion       * region,
+                                              size_t                 size,
+                                              size_t                 alignment);
+
+size_t           TbxHeapRegionGetFree        (tTbxHeapRegion const * region);
+
+size_t           TbxHeapRegionMark           (tTbxHeapRegion const * region);
+
+void             TbxHeapRegionRewind         (tTbxHeapRegion       * region,
+                                              size_t                 mark);
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+void             TbxHeapTraceSetTimestampHandler(tTbxHeapTraceTimestampHandler handler);
+
+size_t           TbxHeapTraceGetLog          (tTbxHeapTraceEntry   * entries,
+                                              size_t                 maxEntries);
+
+size_t           TbxHeapTraceGetTagTotal     (uint8_t                tag);
 
-size_t TbxHeapGetFree (void);
+size_t           TbxHeapTraceGetPeak         (void);
+#endif /* (TBX_CONF_HEAP_TRACE_ENABLE > 0U) */
 
 
 #ifdef __cplusplus
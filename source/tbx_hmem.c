@@ -0,0 +1,741 @@
+/************************************************************************************//**
+* \file         tbx_hmem.c
+* \brief        Handle based memory allocator source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Alignment of all allocated memory and block sizes. */
+#define TBX_HMEM_ALIGN_SIZE            (sizeof(void *))
+
+/** \brief Maximum number of times that the same handle can be locked. */
+#define TBX_HMEM_LOCK_COUNT_MAX        (0xFFFFU)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of the header at the start of each block. The blocks are physically
+ *         located one after the other, without gaps.
+ */
+typedef struct
+{
+  /** \brief Total size of the block in bytes, including this header. */
+  size_t size;
+  /** \brief Handle of the allocation that owns the block. TBX_HMEM_HANDLE_INVALID if the
+   *         block is free.
+   */
+  size_t handle;
+} tHmemBlock;
+
+/** \brief Layout of an entry in the handle table. */
+typedef struct
+{
+  /** \brief Pointer to the block that the handle refers to. NULL if not in use. */
+  uint8_t        * blockPtr;
+  /** \brief Number of times that the handle is locked. Locked blocks are not moved. */
+  uint16_t         lockCount;
+  /** \brief Next handle in the list of handles that are not in use. */
+  tTbxHmemHandle   nextFreeHandle;
+} tHmemHandleEntry;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static tTbxHmem         * TbxHmemCreateInternal(tTbxHeapRegion * region,
+                                                size_t           size,
+                                                tTbxHmemHandle   numHandles);
+
+static tHmemHandleEntry * TbxHmemHandleEntryGet(tTbxHmem       * hmem,
+                                                tTbxHmemHandle   handle);
+
+static void               TbxHmemBlockSplit    (tHmemBlock     * block,
+                                                size_t           size);
+
+static void               TbxHmemBlockMerge    (tTbxHmem       * hmem,
+                                                tHmemBlock     * block);
+
+static void               TbxHmemBlockMove     (uint8_t        * destPtr,
+                                                uint8_t  const * srcPtr,
+                                                size_t           size);
+
+
+/************************************************************************************//**
+** \brief     Creates a new handle based memory allocator with memory taken from the heap.
+**            Instead of a pointer, an allocation results in a handle. The handle resolves
+**            to the allocated memory through a handle table. This makes it possible to
+**            move allocated blocks, without the software program noticing. Function
+**            TbxHmemCompact() makes use of this, by sliding allocated blocks together.
+**            The free memory in between them is thereby combined, which prevents
+**            allocation failures caused by fragmentation. Note that the memory taken from
+**            the heap cannot be given back.
+** \param     size Total size in bytes of the memory that the allocator manages. Each
+**            allocation uses a few bytes of it for its block header.
+** \param     numHandles Maximum number of allocations that can exist at the same time.
+** \return    Pointer to the newly created allocator if successful, NULL otherwise. Make
+**            sure to store the pointer because it serves as a handle to the allocator,
+**            which is needed when calling the other functions of this module.
+**
+****************************************************************************************/
+tTbxHmem * TbxHmemCreate(size_t         size,
+                         tTbxHmemHandle numHandles)
+{
+  /* Create the allocator with memory taken from the default heap. */
+  return TbxHmemCreateInternal(NULL, size, numHandles);
+} /*** end of TbxHmemCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new handle based memory allocator with memory taken from the
+**            specified heap region, instead of from the default heap. Apart from that it
+**            works the same as TbxHmemCreate().
+** \param     region Pointer to a previously created heap region to take the memory from.
+** \param     size Total size in bytes of the memory that the allocator manages. Each
+**            allocation uses a few bytes of it for its block header.
+** \param     numHandles Maximum number of allocations that can exist at the same time.
+** \return    Pointer to the newly created allocator if successful, NULL otherwise.
+**
+****************************************************************************************/
+tTbxHmem * TbxHmemCreateFrom(tTbxHeapRegion * region,
+                             size_t           size,
+                             tTbxHmemHandle   numHandles)
+{
+  tTbxHmem * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (region != NULL)
+  {
+    /* Create the allocator with memory taken from the heap region. */
+    result = TbxHmemCreateInternal(region, size, numHandles);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemCreateFrom ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes from the handle based memory
+**            allocator. New blocks are preferably taken from the memory after the last
+**            block. If this is not possible, the first free block between the existing
+**            blocks that is large enough is taken. Call TbxHmemLock() to obtain a pointer
+**            to the allocated memory.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \param     size The number of bytes to allocate.
+** \return    Handle of the newly allocated memory if successful, TBX_HMEM_HANDLE_INVALID
+**            otherwise.
+**
+****************************************************************************************/
+tTbxHmemHandle TbxHmemAllocate(tTbxHmem * hmem,
+                               size_t     size)
+{
+  tTbxHmemHandle     result = TBX_HMEM_HANDLE_INVALID;
+  tHmemHandleEntry * entry;
+  tHmemBlock       * block = NULL;
+  uint8_t          * blockPtr;
+  size_t             sizeWanted;
+
+  /* Verify parameters. */
+  TBX_ASSERT(hmem != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid and the size can be managed. */
+  if ( (hmem != NULL) && (size > 0U) && (size < (size_t)(hmem->endPtr - hmem->startPtr)) )
+  {
+    /* Determine the total block size, including its header. */
+    sizeWanted = ((size + (TBX_HMEM_ALIGN_SIZE - 1U)) & ~(TBX_HMEM_ALIGN_SIZE - 1U)) + \
+                 sizeof(tHmemBlock);
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Only continue if a handle is available. */
+    if (hmem->freeHandle != TBX_HMEM_HANDLE_INVALID)
+    {
+      /* Is there enough memory left after the last block? */
+      if (sizeWanted <= (size_t)(hmem->endPtr - hmem->topPtr))
+      {
+        /* Take the block from the memory after the last block. */
+        block = (tHmemBlock *)(void *)hmem->topPtr;
+        block->size = sizeWanted;
+        hmem->topPtr = &hmem->topPtr[sizeWanted];
+      }
+      /* Search for the first free block between the existing blocks that fits. */
+      else
+      {
+        blockPtr = hmem->startPtr;
+        while ( (block == NULL) && (blockPtr < hmem->topPtr) )
+        {
+          /* Is this a free block? */
+          if (((tHmemBlock *)(void *)blockPtr)->handle == TBX_HMEM_HANDLE_INVALID)
+          {
+            /* Merge it with the free blocks that follow it. */
+            TbxHmemBlockMerge(hmem, (tHmemBlock *)(void *)blockPtr);
+            /* Was it merged into the memory after the last block? */
+            if (blockPtr == hmem->topPtr)
+            {
+              /* Take the block from the memory after the last block, if it fits now. */
+              if (sizeWanted <= (size_t)(hmem->endPtr - hmem->topPtr))
+              {
+                block = (tHmemBlock *)(void *)hmem->topPtr;
+                block->size = sizeWanted;
+                hmem->topPtr = &hmem->topPtr[sizeWanted];
+              }
+            }
+            /* Does the free block fit? */
+            else if (((tHmemBlock *)(void *)blockPtr)->size >= sizeWanted)
+            {
+              /* Take the block and split off what is not needed. */
+              block = (tHmemBlock *)(void *)blockPtr;
+              TbxHmemBlockSplit(block, sizeWanted);
+            }
+            else
+            {
+              /* Block does not fit. Continue with the next one. */
+            }
+          }
+          /* Continue with the next block, if needed. */
+          if ( (block == NULL) && (blockPtr < hmem->topPtr) )
+          {
+            blockPtr = &blockPtr[((tHmemBlock *)(void *)blockPtr)->size];
+          }
+        }
+      }
+      /* Was a block found? */
+      if (block != NULL)
+      {
+        /* Take a handle from the list of handles that are not in use. */
+        result = hmem->freeHandle;
+        entry = &((tHmemHandleEntry *)hmem->handleTable)[result - 1U];
+        hmem->freeHandle = entry->nextFreeHandle;
+        /* Link the handle and the block. */
+        entry->blockPtr = (uint8_t *)(void *)block;
+        entry->lockCount = 0U;
+        block->handle = result;
+        /* Update the number of used bytes. */
+        hmem->usedBytes += block->size;
+      }
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases previously allocated memory, such that it can be allocated again.
+**            The handle is no longer valid afterwards.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \param     handle Handle of the memory to release. It must have been allocated with
+**            TbxHmemAllocate() from the same allocator and should not be locked.
+**
+****************************************************************************************/
+void TbxHmemRelease(tTbxHmem       * hmem,
+                    tTbxHmemHandle   handle)
+{
+  tHmemHandleEntry * entry;
+  tHmemBlock       * block;
+
+  /* Verify parameters. */
+  TBX_ASSERT(hmem != NULL);
+  TBX_ASSERT(handle != TBX_HMEM_HANDLE_INVALID);
+
+  /* Only continue if the parameters are valid. */
+  if ( (hmem != NULL) && (handle != TBX_HMEM_HANDLE_INVALID) )
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Locate the entry of the handle in the handle table. */
+    entry = TbxHmemHandleEntryGet(hmem, handle);
+    /* Releasing a handle that is not in use or that is still locked, is not allowed. */
+    TBX_ASSERT(entry != NULL);
+    TBX_ASSERT((entry == NULL) || (entry->lockCount == 0U));
+    /* Only continue if the handle is in use and not locked. */
+    if ( (entry != NULL) && (entry->lockCount == 0U) )
+    {
+      /* Mark the block as free. */
+      block = (tHmemBlock *)(void *)entry->blockPtr;
+      block->handle = TBX_HMEM_HANDLE_INVALID;
+      hmem->usedBytes -= block->size;
+      /* Merge it with the free blocks that follow it. */
+      TbxHmemBlockMerge(hmem, block);
+      /* Add the handle to the list of handles that are not in use. */
+      entry->blockPtr = NULL;
+      entry->nextFreeHandle = hmem->freeHandle;
+      hmem->freeHandle = handle;
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+} /*** end of TbxHmemRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Locks the allocated memory, such that it is not moved during compaction,
+**            and obtains a pointer to it. The pointer stays valid until the memory is
+**            unlocked again with TbxHmemUnlock(). Locks can be nested. Keep the memory
+**            locked only as long as needed, because locked memory limits compaction.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \param     handle Handle of the allocated memory.
+** \return    Pointer to the start of the allocated memory if successful, NULL otherwise.
+**
+****************************************************************************************/
+void * TbxHmemLock(tTbxHmem       * hmem,
+                   tTbxHmemHandle   handle)
+{
+  void             * result = NULL;
+  tHmemHandleEntry * entry;
+
+  /* Verify parameters. */
+  TBX_ASSERT(hmem != NULL);
+  TBX_ASSERT(handle != TBX_HMEM_HANDLE_INVALID);
+
+  /* Only continue if the parameters are valid. */
+  if ( (hmem != NULL) && (handle != TBX_HMEM_HANDLE_INVALID) )
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Locate the entry of the handle in the handle table. */
+    entry = TbxHmemHandleEntryGet(hmem, handle);
+    /* Locking a handle that is not in use, or too many times, is not allowed. */
+    TBX_ASSERT(entry != NULL);
+    TBX_ASSERT((entry == NULL) || (entry->lockCount < TBX_HMEM_LOCK_COUNT_MAX));
+    /* Only continue if the handle is in use and can still be locked. */
+    if ( (entry != NULL) && (entry->lockCount < TBX_HMEM_LOCK_COUNT_MAX) )
+    {
+      /* Lock the handle and obtain the memory that follows the block header. */
+      entry->lockCount++;
+      result = &entry->blockPtr[sizeof(tHmemBlock)];
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemLock ***/
+
+
+/************************************************************************************//**
+** \brief     Unlocks the allocated memory, such that it can be moved again during
+**            compaction. The pointer previously obtained with TbxHmemLock() should no
+**            longer be used, unless the memory is still locked by a nested lock.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \param     handle Handle of the allocated memory.
+**
+****************************************************************************************/
+void TbxHmemUnlock(tTbxHmem       * hmem,
+                   tTbxHmemHandle   handle)
+{
+  tHmemHandleEntry * entry;
+
+  /* Verify parameters. */
+  TBX_ASSERT(hmem != NULL);
+  TBX_ASSERT(handle != TBX_HMEM_HANDLE_INVALID);
+
+  /* Only continue if the parameters are valid. */
+  if ( (hmem != NULL) && (handle != TBX_HMEM_HANDLE_INVALID) )
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Locate the entry of the handle in the handle table. */
+    entry = TbxHmemHandleEntryGet(hmem, handle);
+    /* Unlocking a handle that is not in use or not locked, is not allowed. */
+    TBX_ASSERT(entry != NULL);
+    TBX_ASSERT((entry == NULL) || (entry->lockCount > 0U));
+    /* Only continue if the handle is in use and locked. */
+    if ( (entry != NULL) && (entry->lockCount > 0U) )
+    {
+      /* Unlock the handle. */
+      entry->lockCount--;
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+} /*** end of TbxHmemUnlock ***/
+
+
+/************************************************************************************//**
+** \brief     Performs a compaction step. It slides allocated blocks that are not locked
+**            towards the start of the memory, such that the free memory in between them
+**            is combined. The compaction continues where the previous step left off.
+**            The budget limits the time spent in this function and therefore also in
+**            its critical section. This makes it possible to call this function
+**            periodically, for example when the software program is idle.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \param     budget Maximum number of bytes to process in this step. Moving a block
+**            counts as its size and skipping a block counts as the size of its header.
+**            At least one block is always processed, to guarantee progress.
+** \return    TBX_TRUE if the compaction reached the end of the allocated blocks,
+**            TBX_FALSE if more compaction steps are needed.
+**
+****************************************************************************************/
+uint8_t TbxHmemCompact(tTbxHmem * hmem,
+                       size_t     budget)
+{
+  uint8_t            result = TBX_FALSE;
+  uint8_t            budgetExceeded = TBX_FALSE;
+  uint8_t          * blockPtr;
+  tHmemBlock       * block;
+  tHmemBlock       * nextBlock;
+  tHmemHandleEntry * entry;
+  size_t             processed = 0U;
+  size_t             cost;
+  size_t             gapSize;
+  size_t             blockSize;
+
+  /* Verify parameter. */
+  TBX_ASSERT(hmem != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (hmem != NULL)
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Continue where the previous compaction step left off. */
+    blockPtr = hmem->compactPtr;
+    while ( (budgetExceeded == TBX_FALSE) && (blockPtr < hmem->topPtr) )
+    {
+      block = (tHmemBlock *)(void *)blockPtr;
+      /* Is this an allocated block? Note that this can only happen for the first block
+       * or after a locked block. Otherwise the loop always ends on a free block.
+       */
+      if (block->handle != TBX_HMEM_HANDLE_INVALID)
+      {
+        cost = sizeof(tHmemBlock);
+        nextBlock = block;
+        gapSize = 0U;
+      }
+      else
+      {
+        /* Merge the free block with the free blocks that follow it. */
+        TbxHmemBlockMerge(hmem, block);
+        cost = 0U;
+        nextBlock = NULL;
+        gapSize = block->size;
+        /* Is there still an allocated block after it? */
+        if (blockPtr < hmem->topPtr)
+        {
+          nextBlock = (tHmemBlock *)(void *)&blockPtr[gapSize];
+          entry = TbxHmemHandleEntryGet(hmem, (tTbxHmemHandle)nextBlock->handle);
+          /* Determine the cost of moving or skipping the allocated block. */
+          cost = (entry->lockCount == 0U) ? nextBlock->size : sizeof(tHmemBlock);
+        }
+      }
+      /* Is there a block to process? */
+      if (nextBlock != NULL)
+      {
+        /* Is the budget exceeded? Make sure at least one block gets processed. */
+        if ( (processed > 0U) && ((processed + cost) > budget) )
+        {
+          budgetExceeded = TBX_TRUE;
+        }
+        else
+        {
+          processed += cost;
+          entry = TbxHmemHandleEntryGet(hmem, (tTbxHmemHandle)nextBlock->handle);
+          /* Skip the block if there is no free block before it or if it is locked. */
+          if ( (gapSize == 0U) || (entry->lockCount > 0U) )
+          {
+            blockPtr = &((uint8_t *)(void *)nextBlock)[nextBlock->size];
+          }
+          /* Slide the block into the free block before it. */
+          else
+          {
+            blockSize = nextBlock->size;
+            TbxHmemBlockMove(blockPtr, (uint8_t const *)(void *)nextBlock, blockSize);
+            entry->blockPtr = blockPtr;
+            /* The free block now comes after the moved block. */
+            blockPtr = &blockPtr[blockSize];
+            block = (tHmemBlock *)(void *)blockPtr;
+            block->size = gapSize;
+            block->handle = TBX_HMEM_HANDLE_INVALID;
+          }
+        }
+      }
+    }
+    /* Did the compaction reach the end of the allocated blocks? */
+    if (blockPtr >= hmem->topPtr)
+    {
+      /* The next compaction step starts all over again. */
+      hmem->compactPtr = hmem->startPtr;
+      result = TBX_TRUE;
+    }
+    else
+    {
+      /* Store where the next compaction step continues. */
+      hmem->compactPtr = blockPtr;
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemCompact ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of bytes that are not used by allocated blocks.
+**            Note that due to fragmentation, the largest possible allocation can be
+**            smaller than this, until compaction completed.
+** \param     hmem Pointer to a previously created allocator to operate on.
+** \return    Number of free bytes in the allocator.
+**
+****************************************************************************************/
+size_t TbxHmemGetFree(tTbxHmem const * hmem)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(hmem != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (hmem != NULL)
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxCriticalSectionEnter();
+    /* Calculate the number of free bytes. */
+    result = (size_t)(hmem->endPtr - hmem->startPtr) - hmem->usedBytes;
+    /* Release mutual exclusive access to the allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new handle based memory allocator. This function implements
+**            TbxHmemCreate() and TbxHmemCreateFrom().
+** \param     region Pointer to the heap region to take the memory from, or NULL to take
+**            it from the default heap.
+** \param     size Total size in bytes of the memory that the allocator manages.
+** \param     numHandles Maximum number of allocations that can exist at the same time.
+** \return    Pointer to the newly created allocator if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxHmem * TbxHmemCreateInternal(tTbxHeapRegion * region,
+                                        size_t           size,
+                                        tTbxHmemHandle   numHandles)
+{
+  tTbxHmem         * result = NULL;
+  tHmemHandleEntry * handleTable;
+  size_t             sizeAligned;
+  size_t             sizeTotal;
+
+  /* Verify parameters. */
+  TBX_ASSERT(size > 0U);
+  TBX_ASSERT(numHandles > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (size > 0U) && (numHandles > 0U) )
+  {
+    /* Align the size, such that all blocks are aligned. */
+    sizeAligned = (size + (TBX_HMEM_ALIGN_SIZE - 1U)) & ~(TBX_HMEM_ALIGN_SIZE - 1U);
+    /* Create the allocator's administration, directly followed by its handle table and
+     * the memory that it manages.
+     */
+    sizeTotal = sizeof(tTbxHmem) + (numHandles * sizeof(tHmemHandleEntry)) + sizeAligned;
+    if (region == NULL)
+    {
+      result = TbxHeapAllocate(sizeTotal);
+    }
+    else
+    {
+      result = TbxHeapRegionAllocate(region, sizeTotal);
+    }
+    /* Only continue if the allocation was successful. */
+    if (result != NULL)
+    {
+      /* Initialize the handle table. All handles are initially in the list of handles
+       * that are not in use. Note that handle values start at 1.
+       */
+      handleTable = (tHmemHandleEntry *)(void *)&result[1];
+      for (tTbxHmemHandle idx = 0U; idx < numHandles; idx++)
+      {
+        handleTable[idx].blockPtr = NULL;
+        handleTable[idx].lockCount = 0U;
+        handleTable[idx].nextFreeHandle = (idx < (numHandles - 1U)) ?
+                                          (tTbxHmemHandle)(idx + 2U) :
+                                          TBX_HMEM_HANDLE_INVALID;
+      }
+      /* Initialize the allocator's administration. */
+      result->handleTable = handleTable;
+      result->startPtr = (uint8_t *)(void *)&handleTable[numHandles];
+      result->topPtr = result->startPtr;
+      result->endPtr = &result->startPtr[sizeAligned];
+      result->compactPtr = result->startPtr;
+      result->usedBytes = 0U;
+      result->numHandles = numHandles;
+      result->freeHandle = 1U;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemCreateInternal ***/
+
+
+/************************************************************************************//**
+** \brief     Locates the entry of a handle in the handle table.
+** \param     hmem Pointer to the allocator to operate on.
+** \param     handle The handle.
+** \return    Pointer to the entry if the handle is in use, NULL otherwise.
+**
+****************************************************************************************/
+static tHmemHandleEntry * TbxHmemHandleEntryGet(tTbxHmem       * hmem,
+                                                tTbxHmemHandle   handle)
+{
+  tHmemHandleEntry * result = NULL;
+  tHmemHandleEntry * entry;
+
+  /* Only continue if the handle is in range. */
+  if ( (handle != TBX_HMEM_HANDLE_INVALID) && (handle <= hmem->numHandles) )
+  {
+    /* Handle values start at 1. */
+    entry = &((tHmemHandleEntry *)hmem->handleTable)[handle - 1U];
+    /* Only return the entry if the handle is in use. */
+    if (entry->blockPtr != NULL)
+    {
+      result = entry;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHmemHandleEntryGet ***/
+
+
+/************************************************************************************//**
+** \brief     Shrinks a free block to the specified size. What remains is split off as a
+**            new free block, if it is large enough to be useful.
+** \param     block Pointer to the free block.
+** \param     size Desired total size of the block in bytes, including its header.
+**
+****************************************************************************************/
+static void TbxHmemBlockSplit(tHmemBlock * block,
+                              size_t       size)
+{
+  tHmemBlock * remainder;
+
+  /* Only split if the remainder can hold more than just its header. */
+  if (block->size >= (size + sizeof(tHmemBlock) + TBX_HMEM_ALIGN_SIZE))
+  {
+    /* Create the free remainder block right after the block. */
+    remainder = (tHmemBlock *)(void *)&((uint8_t *)(void *)block)[size];
+    remainder->size = block->size - size;
+    remainder->handle = TBX_HMEM_HANDLE_INVALID;
+    /* Shrink the block. */
+    block->size = size;
+  }
+} /*** end of TbxHmemBlockSplit ***/
+
+
+/************************************************************************************//**
+** \brief     Merges a free block with the free blocks that physically follow it. If this
+**            reaches the memory after the last block, the free block becomes part of it.
+** \param     hmem Pointer to the allocator to operate on.
+** \param     block Pointer to the free block.
+**
+****************************************************************************************/
+static void TbxHmemBlockMerge(tTbxHmem   * hmem,
+                              tHmemBlock * block)
+{
+  uint8_t * blockPtr = (uint8_t *)(void *)block;
+  uint8_t * nextPtr = &blockPtr[block->size];
+
+  /* Merge the free blocks that follow it. */
+  while ( (nextPtr < hmem->topPtr) &&
+          (((tHmemBlock *)(void *)nextPtr)->handle == TBX_HMEM_HANDLE_INVALID) )
+  {
+    block->size += ((tHmemBlock *)(void *)nextPtr)->size;
+    nextPtr = &blockPtr[block->size];
+  }
+  /* Was this the last block? */
+  if (nextPtr == hmem->topPtr)
+  {
+    /* Return the free block to the memory after the last block. */
+    hmem->topPtr = blockPtr;
+  }
+  /* The compaction step must continue at the start of a block. Correct it, in case it
+   * pointed to one of the merged blocks.
+   */
+  if ( (hmem->compactPtr > blockPtr) && (hmem->compactPtr <= nextPtr) )
+  {
+    hmem->compactPtr = blockPtr;
+  }
+} /*** end of TbxHmemBlockMerge ***/
+
+
+/************************************************************************************//**
+** \brief     Moves a block to a lower address. The source and destination are allowed to
+**            overlap.
+** \param     destPtr Pointer to the destination. Must be lower than the source.
+** \param     srcPtr Pointer to the source.
+** \param     size Number of bytes to move. Must be a multiple of TBX_HMEM_ALIGN_SIZE.
+**
+****************************************************************************************/
+static void TbxHmemBlockMove(uint8_t       * destPtr,
+                             uint8_t const * srcPtr,
+                             size_t          size)
+{
+  uintptr_t       * destWordPtr = (uintptr_t *)(void *)destPtr;
+  uintptr_t const * srcWordPtr = (uintptr_t const *)(void const *)srcPtr;
+
+  /* Copy word by word in forward direction, which is safe for overlapping memory, as
+   * long as the destination is at a lower address.
+   */
+  for (size_t idx = 0U; idx < (size / sizeof(uintptr_t)); idx++)
+  {
+    destWordPtr[idx] = srcWordPtr[idx];
+  }
+} /*** end of TbxHmemBlockMove ***/
+
+
+/*********************************** end of tbx_hmem.c *********************************/
@@ -0,0 +1,114 @@
+/************************************************************************************//**
+* \file         tbx_hmem.h
+* \brief        Handle based memory allocator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_HMEM_H
+#define TBX_HMEM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Value of a handle that does not refer to an allocation. */
+#define TBX_HMEM_HANDLE_INVALID        (0U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Handle that refers to an allocation of a handle based memory allocator. */
+typedef uint16_t tTbxHmemHandle;
+
+/** \brief Layout of a handle based memory allocator. Its pointer serves as the handle to
+ *         the allocator which is obtained after creation of the allocator and which is
+ *         needed in the other functions of this module. Note that its elements should be
+ *         considered private and only be accessed internally by this module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the handle table, which holds one entry per handle. */
+  void           * handleTable;
+  /** \brief Pointer to the start of the memory that blocks are taken from. */
+  uint8_t        * startPtr;
+  /** \brief Pointer to the end of the last block. Memory after it is not yet used. */
+  uint8_t        * topPtr;
+  /** \brief Pointer to the end of the memory that blocks are taken from. */
+  uint8_t        * endPtr;
+  /** \brief Pointer to the block where the next compaction step continues. */
+  uint8_t        * compactPtr;
+  /** \brief Total number of bytes in the allocated blocks, including their headers. */
+  size_t           usedBytes;
+  /** \brief Total number of handles in the handle table. */
+  tTbxHmemHandle   numHandles;
+  /** \brief First handle in the list of handles that are not in use. */
+  tTbxHmemHandle   freeHandle;
+} tTbxHmem;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxHmem       * TbxHmemCreate    (size_t                size,
+                                   tTbxHmemHandle        numHandles);
+
+tTbxHmem       * TbxHmemCreateFrom(tTbxHeapRegion      * region,
+                                   size_t                size,
+                                   tTbxHmemHandle        numHandles);
+
+tTbxHmemHandle   TbxHmemAllocate  (tTbxHmem            * hmem,
+                                   size_t                size);
+
+void             TbxHmemRelease   (tTbxHmem            * hmem,
+                                   tTbxHmemHandle        handle);
+
+void           * TbxHmemLock      (tTbxHmem            * hmem,
+                                   tTbxHmemHandle        handle);
+
+void             TbxHmemUnlock    (tTbxHmem            * hmem,
+                                   tTbxHmemHandle        handle);
+
+uint8_t          TbxHmemCompact   (tTbxHmem            * hmem,
+                                   size_t                budget);
+
+size_t           TbxHmemGetFree   (tTbxHmem      const * hmem);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_HMEM_H */
+/*********************************** end of tbx_hmem.h *********************************/
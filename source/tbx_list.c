@@ -47,6 +47,17 @@ static tTbxListNode * TbxListFindListNode(tTbxList const * list,
                                           void     const * item);
 
 
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Handle of the memory pool for the lists. NULL as long as not yet created. */
+static tTbxMemPool * tbxListPool = NULL;
+
+/** \brief Handle of the memory pool for the list nodes. NULL as long as not yet created.
+ */
+static tTbxMemPool * tbxListNodePool = NULL;
+
+
 /************************************************************************************//**
 ** \brief     Creates a new and empty linked list and returns its pointer. Make sure to
 **            store the pointer because it serves as a handle to the linked list, which
@@ -57,48 +68,54 @@ static tTbxListNode * TbxListFindListNode(tTbxList const * list,
 tTbxList * TbxListCreate(void)
 {
   tTbxList         * result = NULL;
-  static uint8_t     memPoolsCreated = TBX_FALSE;
-  uint8_t            errorDetected = TBX_FALSE;
   tTbxList         * newListPtr;
-
-  /* Check if this is the first time that this function is called. */
-  if (memPoolsCreated == TBX_FALSE)
+  tTbxMemPool      * listPool = NULL;
+
+  /* Obtain mutual exclusive access to the memory pool handles, such that only one
+   * thread creates the memory pools.
+   */
+  TbxCriticalSectionEnter();
+  /* Check if the memory pools were not yet created. */
+  if ( (tbxListPool == NULL) || (tbxListNodePool == NULL) )
   {
-    /* Invert flag because this part only needs to run one time. */
-    memPoolsCreated = TBX_TRUE;
     /* This module allows the dynamic creation and deletion of a linked list and its
      * nodes. For both these times (tTbxList and tTbxListNode) a memory pool needs to be
      * created. An initial size of 1 is sufficient, because the plan is to expand each
-     * memory pool whenever more blocks need to be allocated from it.
+     * memory pool whenever more blocks need to be allocated from it. Their handles are
+     * stored, such that allocations do not need to look up the memory pool.
      */
-    if (TbxMemPoolCreate(1, sizeof(tTbxList)) == TBX_ERROR)
-    {
-      /* Flag the error. */
-      errorDetected = TBX_TRUE;
-    }
-    if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_ERROR)
+    if ( (TbxMemPoolCreate(1, sizeof(tTbxList)) == TBX_OK) &&
+         (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK) )
     {
-      /* Flag the error. */
-      errorDetected = TBX_TRUE;
+      /* Store the handles of the memory pools. */
+      tbxListPool = TbxMemPoolGetHandle(sizeof(tTbxList));
+      tbxListNodePool = TbxMemPoolGetHandle(sizeof(tTbxListNode));
     }
   }
+  /* Only use the memory pools once both were created. */
+  if ( (tbxListPool != NULL) && (tbxListNodePool != NULL) )
+  {
+    listPool = tbxListPool;
+  }
+  /* Release mutual exclusive access to the memory pool handles. */
+  TbxCriticalSectionExit();
 
-  /* Only continue if no error was detected so far. */
-  if (errorDetected == TBX_FALSE)
+  /* Only continue if the memory pools were created. */
+  if (listPool != NULL)
   {
     /* Attempt to allocate a block for the new list. */
-    newListPtr = TbxMemPoolAllocate(sizeof(tTbxList));
-    /* In case the allocation failed, the memory pool could be exhausted. Try to add
-     * another block to the memory pool. This works as long as there is enough heap
+    newListPtr = TbxMemPoolAllocateFrom(listPool);
+    /* In case the allocation failed, the memory pool could be exhausted. Try to
+     * expand the memory pool. This works as long as there is enough heap
      * configured.
      */
     if (newListPtr == NULL)
     {
-      /* Try to add another block to the memory pool. */
-      if (TbxMemPoolCreate(1, sizeof(tTbxList)) == TBX_OK)
+      /* Try to expand the memory pool, according to its growth policy. */
+      if (TbxMemPoolGrow(sizeof(tTbxList)) == TBX_OK)
       {
         /* Second attempt of the block allocation. */
-        newListPtr = TbxMemPoolAllocate(sizeof(tTbxList));
+        newListPtr = TbxMemPoolAllocateFrom(listPool);
       }
     }
 
@@ -141,7 +158,7 @@ void TbxListDelete(tTbxList * list)
     /* Clear the list. */
     TbxListClear(list);
     /* Release memory of the list. */
-    TbxMemPoolRelease(list);
+    TbxMemPoolReleaseTo(tbxListPool, list);
     /* Release mutual exclusive access of the list. */
     TbxCriticalSectionExit();
   }
@@ -184,7 +201,7 @@ void TbxListClear(tTbxList * list)
        */
       currentListNodePtr = currentListNodePtr->nextNodePtr;
       /* The node is now no longer needed and its memory can be released. */
-      TbxMemPoolRelease(tempListNodePtr);
+      TbxMemPoolReleaseTo(tbxListNodePool, tempListNodePtr);
     }
     /* Set the list to empty now that the memory to each of its nodes was released. */
     list->firstNodePtr = NULL;
@@ -247,18 +264,18 @@ uint8_t TbxListInsertItemFront(tTbxList * list,
   if ( (list != NULL) && (item != NULL) )
   {
     /* Attempt to allocate a block for a node in the list. */
-    newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-    /* In case the allocation failed, the memory pool could be exhausted. Try to add
-     * another block to the memory pool. This works as long as there is enough heap
+    newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
+    /* In case the allocation failed, the memory pool could be exhausted. Try to
+     * expand the memory pool. This works as long as there is enough heap
      * configured.
      */
     if (newListNodePtr == NULL)
     {
-      /* Try to add another block to the memory pool. */
-      if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
+      /* Try to expand the memory pool, according to its growth policy. */
+      if (TbxMemPoolGrow(sizeof(tTbxListNode)) == TBX_OK)
       {
         /* Second attempt of the block allocation. */
-        newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
+        newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
       }
     }
     /* Only continue if the allocation was successful. */
@@ -327,18 +344,18 @@ uint8_t TbxListInsertItemBack(tTbxList * list,
   if ( (list != NULL) && (item != NULL) )
   {
     /* Attempt to allocate a block for a node in the list. */
-    newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-    /* In case the allocation failed, the memory pool could be exhausted. Try to add
-     * another block to the memory pool. This works as long as there is enough heap
+    newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
+    /* In case the allocation failed, the memory pool could be exhausted. Try to
+     * expand the memory pool. This works as long as there is enough heap
      * configured.
      */
     if (newListNodePtr == NULL)
     {
-      /* Try to add another block to the memory pool. */
-      if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
+      /* Try to expand the memory pool, according to its growth policy. */
+      if (TbxMemPoolGrow(sizeof(tTbxListNode)) == TBX_OK)
       {
         /* Second attempt of the block allocation. */
-        newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
+        newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
       }
     }
     /* Only continue if the allocation was successful. */
@@ -418,18 +435,18 @@ uint8_t TbxListInsertItemBefore(tTbxList       * list,
     if (refListNodePtr != NULL)
     {
       /* Attempt to allocate a block for a node in the list. */
-      newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      /* In case the allocation failed, the memory pool could be exhausted. Try to add
-       * another block to the memory pool. This works as long as there is enough heap
+      newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
+      /* In case the allocation failed, the memory pool could be exhausted. Try to
+       * expand the memory pool. This works as long as there is enough heap
        * configured.
        */
       if (newListNodePtr == NULL)
       {
-        /* Try to add another block to the memory pool. */
-        if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
+        /* Try to expand the memory pool, according to its growth policy. */
+        if (TbxMemPoolGrow(sizeof(tTbxListNode)) == TBX_OK)
         {
           /* Second attempt of the block allocation. */
-          newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
+          newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
         }
       }
       /* Only continue if the allocation was successful. */
@@ -509,18 +526,18 @@ uint8_t TbxListInsertItemAfter(tTbxList       * list,
     if (refListNodePtr != NULL)
     {
       /* Attempt to allocate a block for a node in the list. */
-      newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      /* In case the allocation failed, the memory pool could be exhausted. Try to add
-       * another block to the memory pool. This works as long as there is enough heap
+      newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
+      /* In case the allocation failed, the memory pool could be exhausted. Try to
+       * expand the memory pool. This works as long as there is enough heap
        * configured.
        */
       if (newListNodePtr == NULL)
       {
-        /* Try to add another block to the memory pool. */
-        if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
+        /* Try to expand the memory pool, according to its growth policy. */
+        if (TbxMemPoolGrow(sizeof(tTbxListNode)) == TBX_OK)
         {
           /* Second attempt of the block allocation. */
-          newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
+          newListNodePtr = TbxMemPoolAllocateFrom(tbxListNodePool);
         }
       }
       /* Only continue if the allocation was successful. */
@@ -664,7 +681,7 @@ void TbxListRemoveItem(tTbxList       * list,
       /* Release mutual exclusive access of the list. */
       TbxCriticalSectionExit();
       /* Give the node back to the memory pool. */
-      TbxMemPoolRelease(listNodePtr);
+      TbxMemPoolReleaseTo(tbxListNodePool, listNodePtr);
     }
   }
 } /*** end of TbxListRemoveItem ***/
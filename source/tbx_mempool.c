@@ -40,32 +40,163 @@
 #include "microtbx.h"                            /* MicroTBX global header             */
 
 
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_MEMPOOL_INDEX_SIZE_MAX
+/** \brief Configure the largest block size in bytes that the size class index of the
+ *         memory pools covers. The index makes it possible to find the memory pool for a
+ *         block size, without walking the list with memory pools. Each
+ *         TBX_MEMPOOL_INDEX_GRANULARITY bytes cost one pointer of RAM. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_INDEX_SIZE_MAX          (256U)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_GROWTH_POLICY
+/** \brief Configure the default growth policy of newly created memory pools. It
+ *         determines by how many blocks TbxMemPoolGrow() expands a memory pool. Either
+ *         TBX_MEMPOOL_GROWTH_FIXED or TBX_MEMPOOL_GROWTH_DOUBLE. Note that it is possible
+ *         to override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_MEMPOOL_GROWTH_POLICY           (TBX_MEMPOOL_GROWTH_FIXED)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_GROWTH_BLOCKS
+/** \brief Configure the default growth blocks of newly created memory pools. With policy
+ *         TBX_MEMPOOL_GROWTH_FIXED, this is the number of blocks to add. With policy
+ *         TBX_MEMPOOL_GROWTH_DOUBLE, this is the maximum number of blocks to add at once,
+ *         where 0 means no maximum. Note that it is possible to override this value by
+ *         adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_GROWTH_BLOCKS           (1U)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_MAGAZINE_SIZE
+/** \brief Configure the maximum number of free blocks that each thread caches in its
+ *         magazine, per size class. Allocating and releasing blocks through the
+ *         magazine does not touch any shared data. The magazine is refilled from and
+ *         emptied to the memory pool in batches. Set to 0 to disable. Requires a port
+ *         that supports thread-local storage. Note that it is possible to override this
+ *         value by adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_MAGAZINE_SIZE           (0U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of bytes in each size class of the memory pool index. */
+#define TBX_MEMPOOL_INDEX_GRANULARITY  (8U)
+
+/** \brief Number of size classes in the memory pool index. */
+#define TBX_MEMPOOL_INDEX_COUNT        (TBX_CONF_MEMPOOL_INDEX_SIZE_MAX / \
+                                        TBX_MEMPOOL_INDEX_GRANULARITY)
+
+/** \brief Number of blocks that an empty magazine is refilled with. Half of its size,
+ *         such that a thread that alternates between allocating and releasing does not
+ *         continuously refill and empty its magazine.
+ */
+#define TBX_MEMPOOL_MAGAZINE_BATCH     ((TBX_CONF_MEMPOOL_MAGAZINE_SIZE + 1U) / 2U)
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (TBX_CONF_MEMPOOL_INDEX_SIZE_MAX < TBX_MEMPOOL_INDEX_GRANULARITY) || \
+    ((TBX_CONF_MEMPOOL_INDEX_SIZE_MAX % TBX_MEMPOOL_INDEX_GRANULARITY) != 0U)
+#error "TBX_CONF_MEMPOOL_INDEX_SIZE_MAX must be a non-zero multiple of 8."
+#endif
+
+#if (TBX_CONF_MEMPOOL_GROWTH_POLICY != TBX_MEMPOOL_GROWTH_FIXED) && \
+    (TBX_CONF_MEMPOOL_GROWTH_POLICY != TBX_MEMPOOL_GROWTH_DOUBLE)
+#error "TBX_CONF_MEMPOOL_GROWTH_POLICY is invalid."
+#endif
+
+#if (TBX_CONF_MEMPOOL_GROWTH_POLICY == TBX_MEMPOOL_GROWTH_FIXED) && \
+    (TBX_CONF_MEMPOOL_GROWTH_BLOCKS == 0U)
+#error "TBX_CONF_MEMPOOL_GROWTH_BLOCKS must be > 0 with policy TBX_MEMPOOL_GROWTH_FIXED."
+#endif
+
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+#ifndef TBX_PORT_THREAD_LOCAL
+#error "TBX_CONF_MEMPOOL_MAGAZINE_SIZE requires a port that supports thread-local storage."
+#endif
+#endif
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
-/** \brief Layout of a block node, which forms the building block of a linked list
- *         consisting of data blocks.
+/** \brief Layout of the header at the start of a slab. A slab is the contiguous memory
+ *         that holds the blocks, which were added to a memory pool in one go. Once all
+ *         its blocks are free, the slab can be released for reuse by any memory pool.
+ *         The header then describes the free memory of the released slab.
  */
-typedef struct t_block_node
+typedef struct t_slab
 {
-  /** \brief Pointer to the block. */
-  void                * blockPtr;
-  /** \brief Pointer to the next node in the list or NULL if it is the list end. */
-  struct t_block_node * nextNodePtr;
-} tBlockNode;
-
-/** \brief Linked list consisting of data block nodes. */
-typedef tBlockNode (* tBlockList);
+  /** \brief Pointer to the next slab of the same memory pool, or to the next released
+   *         slab.
+   */
+  struct t_slab * nextSlabPtr;
+  /** \brief Total number of bytes of the slab, including this header. */
+  size_t          size;
+  /** \brief Number of blocks in the slab. A reused slab can be larger than needed for
+   *         its blocks, so this does not follow from its size.
+   */
+  size_t          numBlocks;
+} tSlab;
 
-/** \brief Layout of a single memory pool. */
-typedef struct
+/** \brief Layout of a single memory pool. Its structure tag matches the incomplete type
+ *         tTbxMemPool of the memory pool handles.
+ */
+typedef struct t_tbx_mem_pool
 {
   /** \brief The number of bytes that fit in one block. */
-  size_t       blockSize;
-  /** \brief Pointer to the linked list with free data block nodes. */
-  tBlockList * freeBlockListPtr;
-  /** \brief Pointer to the linked list with used data block nodes. */
-  tBlockList * usedBlockListPtr;
+  size_t              blockSize;
+  /** \brief Total number of blocks in the memory pool. */
+  size_t              numBlocks;
+  /** \brief Alignment of the data of each block in bytes. */
+  size_t              alignment;
+  /** \brief Pointer to the first slab in the linked list with slabs of the memory pool. */
+  tSlab             * slabListPtr;
+  /** \brief Number of blocks that TbxMemPoolGrow() adds, or the maximum number of
+   *         blocks, depending on the growth policy.
+   */
+  size_t              growthBlocks;
+  /** \brief Growth policy (TBX_MEMPOOL_GROWTH_xxx). */
+  uint8_t             growthPolicy;
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+  /** \brief Number of blocks that are currently allocated. */
+  size_t volatile     usedBlocks;
+  /** \brief Highest number of blocks that were allocated at the same time. */
+  size_t volatile     peakUsedBlocks;
+  /** \brief Number of allocations that failed, because no free block was available. */
+  size_t volatile     failedAllocs;
+#endif
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+  /** \brief Pointer to the first block in the linked list with free blocks or NULL if
+   *         the list is empty, combined with a tag that changes with each update. The
+   *         pointer to the next free block is stored in the data of the free block
+   *         itself, because its data is not used while it is free. The tag makes it
+   *         possible to update the list lock-free, without suffering from the ABA
+   *         problem.
+   */
+  tTbxPortTaggedPtr   freeBlockList;
+#else
+  /** \brief Pointer to the first block in the linked list with free blocks or NULL if
+   *         the list is empty. The pointer to the next free block is stored in the data
+   *         of the free block itself, because its data is not used while it is free.
+   */
+  void              * freeBlockListPtr;
+#if (TBX_PORT_LOCKS_SUPPORTED > 0U)
+  /** \brief Lock that protects the linked list with free blocks. */
+  tTbxPortLock        lock;
+#endif
+#endif /* (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U) */
 } tPool;
 
 /** \brief Layout of a memory pool node, which forms the building block of a linked list
@@ -76,59 +207,191 @@ typedef struct t_pool_node
   /** \brief Pointer to the memory pool. */
   tPool              * poolPtr;
   /** \brief Pointer to the next node in the list or NULL if it is the list end. */
-  struct t_pool_node * nextNodePtr;
+  struct t_pool_node * volatile nextNodePtr;
 } tPoolNode;
 
 /** \brief Linked list consisting of memory pool nodes. */
 typedef tPoolNode (* tPoolList);
 
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+/** \brief Layout of a magazine. It caches free blocks of one memory pool for one thread.
+ *         Its blocks are linked together in the same way as in the free block list of
+ *         the memory pool.
+ */
+typedef struct
+{
+  /** \brief Pointer to the memory pool that the blocks belong to, or NULL if none. */
+  tPool  * poolPtr;
+  /** \brief Pointer to the first block in the magazine. */
+  void   * firstBlockPtr;
+  /** \brief Pointer to the last block in the magazine. */
+  void   * lastBlockPtr;
+  /** \brief Number of blocks in the magazine. */
+  size_t   numBlocks;
+} tMagazine;
+#endif
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
+/* Pool creation functions. */
+static uint8_t      TbxMemPoolCreateInternal   (size_t             numBlocks,
+                                                size_t             blockSize,
+                                                size_t             alignment);
+
+/* Pool access functions. */
+static void       * TbxMemPoolAllocateInternal (tPool            * poolPtr,
+                                                uint8_t            countFailure);
+
+static void         TbxMemPoolReleaseInternal  (tPool            * poolPtr,
+                                                void             * blockPtr);
+
 /* Pool list management functions */
-static tPoolNode  * TbxMemPoolListFind         (size_t             blockSize);
+static tPoolNode  * TbxMemPoolListLookup       (size_t             blockSize);
+
+static tPoolNode  * TbxMemPoolListLoad         (tPoolNode * volatile const * nodePtrPtr);
 
-static tPoolNode  * TbxMemPoolListFindBestFit  (size_t             blockSize);
+static void         TbxMemPoolListStore        (tPoolNode * volatile * nodePtrPtr,
+                                                tPoolNode            * nodePtr);
+
+static tPoolNode  * TbxMemPoolListFind         (size_t             blockSize);
 
 static void         TbxMemPoolListInsert       (tPoolNode        * nodePtr);
 
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+static uint8_t      TbxMemPoolListContains     (tPool      const * poolPtr);
+#endif
+
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED == 0U)
+/* Pool locking functions. */
+static void         TbxMemPoolLockInit         (tPool            * poolPtr);
+
+static void         TbxMemPoolLockAcquire      (tPool            * poolPtr);
+
+static void         TbxMemPoolLockRelease      (tPool            * poolPtr);
+#endif
+
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+/* Magazine functions. */
+static tMagazine  * TbxMemPoolMagazineGet      (tPool      const * poolPtr);
+
+static void         TbxMemPoolMagazineEmpty    (tMagazine        * magazinePtr);
+
+static void       * TbxMemPoolMagazineAllocate (tPool            * poolPtr);
+
+static void         TbxMemPoolMagazineRelease  (tPool            * poolPtr,
+                                                void             * blockPtr);
+#endif
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/* Statistics functions. */
+static void         TbxMemPoolStatsAllocated   (tPool            * poolPtr,
+                                                size_t             numBlocks,
+                                                size_t             numRequested);
+
+static void         TbxMemPoolStatsReleased    (tPool            * poolPtr,
+                                                size_t             numBlocks);
+
+static void         TbxMemPoolStatsRead        (tPool      const * poolPtr,
+                                                tTbxMemPoolStats * stats);
+#endif
+
+/* Slab management functions. */
+static uint8_t    * TbxMemPoolSlabAllocate     (size_t           * sizePtr,
+                                                size_t             alignment);
+
+static void         TbxMemPoolSlabRelease      (tSlab            * slabPtr);
+
+static size_t       TbxMemPoolSlabGetOffset    (size_t             alignment);
+
+
+static size_t       TbxMemPoolSlabCountBlocks  (tSlab      const * slabPtr,
+                                                void             * firstBlockPtr,
+                                                size_t             numBlocks);
+
+static size_t       TbxMemPoolSlabRemoveBlocks (tSlab      const * slabPtr,
+                                                void            ** firstBlockPtr,
+                                                void            ** lastBlockPtr,
+                                                size_t             numBlocks);
+
 /* Block management functions. */
-static void       * TbxMemPoolBlockCreate      (size_t             size);
+static size_t       TbxMemPoolBlockGetStride   (size_t             size,
+                                                size_t             alignment);
+
+static void         TbxMemPoolBlockInit        (void             * memPtr,
+                                                tPool            * poolPtr);
 
 static void       * TbxMemPoolBlockGetDataPtr  (void             * memPtr);
 
-static size_t       TbxMemPoolBlockGetBlockSize(void       const * memPtr);
+static tPool      * TbxMemPoolBlockGetPool     (void       const * memPtr);
 
 static void       * TbxMemPoolBlockGetMemPtr   (void             * dataPtr);
 
+static void         TbxMemPoolBlockCopy        (void             * destPtr,
+                                                void       const * srcPtr,
+                                                size_t             size);
+
 /* Block list management functions. */
-static tBlockList * TbxMemPoolBlockListCreate  (void);
+static void         TbxMemPoolBlockListInit    (tPool            * poolPtr);
 
-static void         TbxMemPoolBlockListInsert  (tBlockList       * listPtr,
-                                                tBlockNode       * nodePtr);
+static void         TbxMemPoolBlockListInsert  (tPool            * poolPtr,
+                                                void             * firstBlockPtr,
+                                                void             * lastBlockPtr);
                                               
-static tBlockNode * TbxMemPoolBlockListExtract (tBlockList       * listPtr);
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE == 0U) || (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+static void       * TbxMemPoolBlockListExtract (tPool            * poolPtr);
+#endif
 
-static uint8_t      TbxMemPoolBlockListIsEmpty (tBlockList const * listPtr);
+static size_t       TbxMemPoolBlockListExtractChain(tPool        * poolPtr,
+                                                    size_t         maxBlocks,
+                                                    void        ** firstBlockPtr,
+                                                    void        ** lastBlockPtr);
 
 
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
-/** \brief Linked list with memory pools. */
-static tPoolList tbxPoolList = NULL;
+/** \brief Linked list with memory pools. Only the insertion of memory pool nodes into
+ *         this list happens in the critical section. Memory pool nodes are never removed
+ *         and they are fully initialized before they are linked in. On ports with
+ *         atomics, the nodes are linked in with a release store and the list is searched
+ *         with acquire loads, without any locking. Each memory pool protects its own
+ *         free block list with its own lock.
+ */
+static tPoolList volatile tbxPoolList = NULL;
+
+/** \brief Size class index of the linked list with memory pools. Each entry points to
+ *         the first memory pool node in the list, with a block size that is large enough
+ *         for the smallest size in the size class. Entry 0 is for sizes 1..8, entry 1 for
+ *         sizes 9..16, etc.
+ */
+static tPoolNode * volatile tbxPoolIndex[TBX_MEMPOOL_INDEX_COUNT];
+
+/** \brief Linked list with the slabs that were released by TbxMemPoolShrink(). Their
+ *         memory is reused for the slabs of new blocks, before taking memory from the
+ *         heap. Protected by the critical section.
+ */
+static tSlab * tbxPoolFreeSlabList = NULL;
+
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+/** \brief Magazines of the calling thread, one for each size class of the size class
+ *         index.
+ */
+static TBX_PORT_THREAD_LOCAL tMagazine tbxPoolMagazines[TBX_MEMPOOL_INDEX_COUNT];
+#endif
 
 
 /************************************************************************************//**
 ** \brief     Creates a new memory pool with the specified number of blocks, where each
 **            block has the size as specified by the second function parameter. The
-**            required memory is statically preallocated on the heap. This function is
-**            typically called one or more times during software program initialization,
-**            before the infinite program loop is entered. Once one or more memory pools
-**            were created, the functions TbxMemPoolAllocate() and TbxMemPoolRelease()
-**            can be called to perform dynamic memory allocation. A well designed memory
-**            pool approach makes dynamic memory allocation possible on RAM constrained
+**            required memory is statically preallocated on the heap, as one contiguous
+**            slab that holds all the blocks. This function is typically called one or
+**            more times during software program initialization, before the infinite
+**            program loop is entered. Once one or more memory pools were created, the
+**            functions TbxMemPoolAllocate() and TbxMemPoolRelease() can be called to
+**            perform dynamic memory allocation. A well designed memory pool approach
+**            makes dynamic memory allocation possible on RAM constrained
 **            microcontrollers, without the need to worry about memory fragmentation.
 **            Note that deleting a previously created memory pool is not supported on
 **            purpose to prevent memory fragmentation.
@@ -147,138 +410,52 @@ static tPoolList tbxPoolList = NULL;
 uint8_t TbxMemPoolCreate(size_t numBlocks, 
                          size_t blockSize)
 {
-  uint8_t      result = TBX_ERROR;
-  void       * blockPtr;
-  tPool      * poolPtr;
+  /* Create or extend the memory pool. An existing memory pool keeps its alignment. */
+  return TbxMemPoolCreateInternal(numBlocks, blockSize, 0U);
+} /*** end of TbxMemPoolCreate ***/
 
-  /* Verify parameters. */
-  TBX_ASSERT(numBlocks > 0U);
-  TBX_ASSERT(blockSize > 0U);
 
-  /* Only continue if the parameters are valid. */
-  if ( (numBlocks > 0U) && (blockSize > 0U) )
+/************************************************************************************//**
+** \brief     Same as TbxMemPoolCreate(), but guarantees that the data of each block in the
+**            memory pool is aligned to the specified boundary. For example 16 or 32 bytes
+**            for SIMD operations, or the size of a cache line for objects that are used
+**            by different CPU cores. The latter prevents that two such objects share a
+**            cache line, which would otherwise cost coherence traffic between the CPU
+**            cores. The alignment is a property of the memory pool. Once created, a
+**            memory pool is always extended with blocks of the same alignment, also by
+**            TbxMemPoolCreate() and TbxMemPoolGrow(). Note that each block is preceded
+**            by a pointer to its memory pool, so to not waste memory, the block size
+**            should be a multiple of the alignment, minus the size of a pointer.
+** \param     numBlocks The number of blocks to statically preallocate on the heap for
+**            this memory pool.
+** \param     blockSize The size of each block in bytes.
+** \param     alignment Desired alignment of the data of each block in bytes. Must be a
+**            power of two, for example 16, 32 or 64.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there is no
+**            more space available on the heap to statically preallocated the blocks, or
+**            when the memory pool already exists with a smaller alignment.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolCreateAligned(size_t numBlocks,
+                                size_t blockSize,
+                                size_t alignment)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. The others are verified when creating the memory pool. */
+  TBX_ASSERT(alignment > 0U);
+  TBX_ASSERT((alignment & (alignment - 1U)) == 0U);
+
+  /* Only continue if the parameter is valid. */
+  if ( (alignment > 0U) && ((alignment & (alignment - 1U)) == 0U) )
   {
-    /* Set the result value to okay. */
-    result = TBX_OK;
-    /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
-    /* Attempt to locate a memory pool node in the list that is configured for the same
-     * block size.
-     */
-    tPoolNode * poolNodePtr = TbxMemPoolListFind(blockSize);
-    /* Create a new memory pool node and its associated empty memory pool if a memory
-     * pool node for this block size does not yet exist.
-     */
-    if (poolNodePtr == NULL)
-    {
-      /* Create a new memory pool node. */
-      poolNodePtr = TbxHeapAllocate(sizeof(tPoolNode));
-      /* Verify that the memory pool node could be created. */
-      if (poolNodePtr == NULL)
-      {
-        /* Flag the error. */
-        result = TBX_ERROR;
-      }
-      /* Continue with creating the memory pool object. */
-      else
-      {
-        /* Create a new memory pool object. */
-        poolPtr = TbxHeapAllocate(sizeof(tPool));
-        /* Verify that the memory pool object could be created. */
-        if (poolPtr == NULL)
-        {
-          /* Flag the error. */
-          result = TBX_ERROR;
-        }
-        /* Continue with initializing both the memory pool and its node. */
-        else
-        {
-          /* Initialize the memory pool node. */
-          poolNodePtr->nextNodePtr = NULL;
-          poolNodePtr->poolPtr = poolPtr;
-          /* Store the data size of the blocks managed by the memory pool. */
-          poolPtr->blockSize = blockSize;
-          /* Create the block list object that will hold blocks that are still free. */
-          poolPtr->freeBlockListPtr = TbxMemPoolBlockListCreate();
-          /* Create the block list object that will hold blocks that are in use. */
-          poolPtr->usedBlockListPtr = TbxMemPoolBlockListCreate();
-          /* Verify that the block list objects could be created. */
-          if ( (poolPtr->freeBlockListPtr == NULL) ||
-               (poolPtr->usedBlockListPtr == NULL) )
-          {
-            /* Flag the error. */
-            result = TBX_ERROR;
-          }
-          /* The (empty) memory pool and its node were created. Time to insert it into
-           * the list.
-           */
-          else
-          {
-            TbxMemPoolListInsert(poolNodePtr);
-          }
-        }
-      }
-    }
-    /* Only continue if all is okay so far. */
-    if (result == TBX_OK)
-    {
-      /* The pool node pointer it now valid. It either points to a node that holds a
-       * newly created and empty memory pool or to a node that holds an already existing
-       * memory pool that can be extended. Create the blocks one by one and add them as
-       * nodes to the free block list.
-       */
-      for (size_t blockNodeIdx = 0U; blockNodeIdx < numBlocks; blockNodeIdx++)
-      {
-        /* Allocate memory for the block node. */
-        tBlockNode * blockNodePtr = TbxHeapAllocate(sizeof(tBlockNode));
-        /* Verify that the node could be allocated. */
-        if (blockNodePtr == NULL)
-        {
-          /* Flag the error. */
-          result = TBX_ERROR;
-        }
-        /* The node was created. */
-        else
-        {
-          /* Allocate memory for the actual data block itself. */
-          blockPtr = TbxMemPoolBlockCreate(blockSize);
-          /* Verify that the the data block could be allocated. */
-          if (blockPtr == NULL)
-          {
-            /* Flag the error. */
-            result = TBX_ERROR;
-          }
-          /* The data block was created. */
-          else
-          {
-            /* Initialize the block node. */
-            blockNodePtr->blockPtr = blockPtr;
-            blockNodePtr->nextNodePtr = NULL;
-            /* Sanity check. The pool node pointer should not be NULL here. */
-            TBX_ASSERT(poolNodePtr != NULL);
-            /* Flag error in case the sanity check failed. */
-            if (poolNodePtr == NULL)
-            {
-              /* Flag the error. */
-              result = TBX_ERROR;
-            }
-            else
-            {
-              /* Insert the block node into the free block list. */
-              TbxMemPoolBlockListInsert(poolNodePtr->poolPtr->freeBlockListPtr,
-                                        blockNodePtr);
-            }
-          }
-        }
-      }
-    }
-    /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
+    /* Create or extend the memory pool with the desired alignment. */
+    result = TbxMemPoolCreateInternal(numBlocks, blockSize, alignment);
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolCreate ***/
+} /*** end of TbxMemPoolCreateAligned ***/
 
 
 /************************************************************************************//**
@@ -305,7 +482,6 @@ uint8_t TbxMemPoolCreate(size_t numBlocks,
 void * TbxMemPoolAllocate(size_t size)
 {
   void            * result = NULL;
-  void            * blockDataPtr;
   tPoolNode const * poolNodePtr;
 
   /* Verify parameter. */
@@ -314,41 +490,26 @@ void * TbxMemPoolAllocate(size_t size)
   /* Only continue if the parameter is valid. */
   if (size > 0U)
   {
-    /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
-    /* Try to find the best fitting memory pool that has a block available. */
-    poolNodePtr = TbxMemPoolListFindBestFit(size);
+    /* Find the best fitting memory pool. This is the first one with a block size that
+     * is large enough. The search does not continue with the next memory pool, even if
+     * this one does not have any free blocks available. This was done on purpose, such
+     * that the caller can expand this memory pool with TbxMemPoolCreate() instead.
+     */
+    poolNodePtr = TbxMemPoolListLookup(size);
     /* Only continue with the allocation of a memory pool candidate was found. */
     if (poolNodePtr != NULL)
     {
       /* Get the pointer to the actual memory pool. */
-      tPool const * poolPtr = poolNodePtr->poolPtr;
+      tPool * poolPtr = poolNodePtr->poolPtr;
       /* Sanity check. The memory pool should not be NULL here. */
       TBX_ASSERT(poolPtr != NULL);
       /* Only continue if the sanity check passed. */
       if (poolPtr != NULL)
       {
-        /* Attempt to extract a block node from the linked list with free block nodes. */
-        tBlockNode * blockNodePtr = TbxMemPoolBlockListExtract(poolPtr->freeBlockListPtr);
-        /* Only continue if a free block node could be extracted. */
-        if (blockNodePtr != NULL)
-        {
-          /* Read and store the pointer that points to the block's data. */
-          blockDataPtr = TbxMemPoolBlockGetDataPtr(blockNodePtr->blockPtr);
-          /* Now the node itself needs to be inserted into the linked list with used
-           * block nodes. This way this node can be reused when freeing this or another
-           * block.
-           */
-          TbxMemPoolBlockListInsert(poolPtr->usedBlockListPtr, blockNodePtr);
-          /* Perform a sanity check. The block's data pointer should not be NULL here. */
-          TBX_ASSERT(blockDataPtr != NULL);
-          /* Set the result value. */
-          result = blockDataPtr;
-        }
+        /* Attempt to allocate a block from the memory pool. */
+        result = TbxMemPoolAllocateInternal(poolPtr, TBX_TRUE);
       }
     }
-    /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
   }
 
   /* Give the result back to the caller. */
@@ -358,10 +519,11 @@ void * TbxMemPoolAllocate(size_t size)
 
 /************************************************************************************//**
 ** \brief     An alternative version of TbxMemPoolAllocate(), which automatically creates
-**            a new memory pool with one block, if one with the exact same blockSize was
-**            not yet created. If one with the exact same blockSize was already created,
-**            but it's full, then the memory pool is automatically expanded to have one
-**            more block.
+**            a new memory pool, if one with the exact same blockSize was not yet
+**            created. If one with the exact same blockSize was already created, but it's
+**            full, then the memory pool is automatically expanded. The number of blocks
+**            that are added, is determined by the growth policy of the memory pool. Refer
+**            to TbxMemPoolGrow() for details.
 ** \details   This offers a convenient way of working with memory pools compared to
 **            TbxMemPoolAllocate(). In addition, it guarantees that it always works on
 **            a memory pool where the blockSize  == "size". It bypasses the best fitting
@@ -381,7 +543,8 @@ void * TbxMemPoolAllocate(size_t size)
 **            including adding 1 block of 32 bytes to it, which was immediately
 **            allocated. During the second call to TbxMemPoolAllocateAuto(), another
 **            block of 32 bytes was automatically added to the existing memory pool and
-**            the newly added block was immediately allocated.
+**            the newly added block was immediately allocated. This assumes the default
+**            growth policy, which adds one block at a time.
 ** \param     size The number of bytes to allocate using a memory pool.
 ** \return    Pointer to the start of the newly allocated memory if successful, NULL
 **            otherwise.
@@ -390,8 +553,7 @@ void * TbxMemPoolAllocate(size_t size)
 void * TbxMemPoolAllocateAuto(size_t size)
 {
   void            * result      = NULL;
-  tPoolNode const * poolNodePtr = NULL;
-  tPoolNode const * currentPoolNodePtr;
+  tPoolNode const * poolNodePtr;
 
   /* Verify parameter. */
   TBX_ASSERT(size > 0U);
@@ -399,28 +561,8 @@ void * TbxMemPoolAllocateAuto(size_t size)
   /* Only continue if the parameter is valid. */
   if (size > 0U)
   {
-    /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
-    /* Get pointer to the pool node at the head of the linked list. */
-    currentPoolNodePtr = tbxPoolList;
-    /* Loop through all nodes until one of the exact same size is found. */
-    while (currentPoolNodePtr != NULL)
-    {
-      /* Does this memory pool hold blocks of the exact same size? */
-      if (currentPoolNodePtr->poolPtr->blockSize == size)
-      {
-        /* Existing memory pool of the exact same size was found. Set the poolNodePtr to
-         * point to this memory pool.
-         */
-        poolNodePtr = currentPoolNodePtr;
-        /* Memory pool found, so no need to continue searching. */
-        break;
-      }
-      /* Continue with the next pool node in the list. */
-      currentPoolNodePtr = currentPoolNodePtr->nextNodePtr;
-    }
-    /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
+    /* Attempt to locate a memory pool of the exact same size. */
+    poolNodePtr = TbxMemPoolListFind(size);
 
     /* No memory pool with the exact same size found? */
     if (poolNodePtr == NULL)
@@ -428,10 +570,10 @@ void * TbxMemPoolAllocateAuto(size_t size)
       /* Automatically create a memory pool with the blockSize set to the size to
        * allocate. 
        */
-      if (TbxMemPoolCreate(1U, size) == TBX_OK)
+      if (TbxMemPoolGrow(size) == TBX_OK)
       {
         /* Allocate a block from the newly created memory pool. Should always work, since
-         * we just created a memory pool with one block.
+         * we just created a memory pool with at least one block.
          */
         result = TbxMemPoolAllocate(size);      
       }
@@ -439,19 +581,23 @@ void * TbxMemPoolAllocateAuto(size_t size)
     /* Memory pool with the exact same size found. */
     else
     {
-      /* Allocate a block from the memory pool. */
-      result = TbxMemPoolAllocate(size);
+      /* Allocate a block from the memory pool. A failure is not counted in the
+       * statistics yet, because the memory pool is expanded and the allocation is
+       * attempted again in that case.
+       */
+      result = TbxMemPoolAllocateInternal(poolNodePtr->poolPtr, TBX_FALSE);
       /* No more blocks available in the memory pool? */
       if (result == NULL)
       {
-        /* Automatically increase the memory pool by adding one more block to it. */
-        if (TbxMemPoolCreate(1U, size) == TBX_OK)
-        {
-          /* Allocate a block from the memory pool. Should always work, since we just
-           * expanded it with one block.
-           */
-          result = TbxMemPoolAllocate(size);      
-       }
+        /* Automatically expand the memory pool, according to its growth policy. No
+         * need to check the return value, because another thread could have released
+         * a block in the meantime. The allocation is attempted again in any case.
+         */
+        (void)TbxMemPoolGrow(size);
+        /* Allocate a block from the memory pool. Should work, unless the memory pool
+         * could not be expanded.
+         */
+        result = TbxMemPoolAllocateInternal(poolNodePtr->poolPtr, TBX_TRUE);
       }
     }
   }
@@ -462,293 +608,2176 @@ void * TbxMemPoolAllocateAuto(size_t size)
 
 
 /************************************************************************************//**
-** \brief     Releases the previously allocated block of memory. Once the memory is
-**            released, it can be allocated again afterwards with function
-**            TbxMemPoolAllocate(). Note that this function automatically finds the
-**            memory pool that the memory block belongs to.
-** \param     memPtr Pointer to the start of the memory block. Basically, the pointer
-**            that was returned by function TbxMemPoolAllocate(), when the memory was
-**            initially allocated.
+** \brief     Expands the memory pool with the specified block size, according to its
+**            growth policy. With policy TBX_MEMPOOL_GROWTH_FIXED, a fixed number of
+**            blocks is added. With policy TBX_MEMPOOL_GROWTH_DOUBLE, the number of
+**            blocks in the memory pool is doubled, optionally up to a maximum number of
+**            blocks per expansion. This way a burst of allocations only needs a few
+**            expansions. If the memory pool does not yet exist, it is created with the
+**            default growth policy, as configured with TBX_CONF_MEMPOOL_GROWTH_POLICY
+**            and TBX_CONF_MEMPOOL_GROWTH_BLOCKS. In case there is not enough space on the
+**            heap for all blocks of the expansion, the memory pool is expanded with just
+**            one block instead.
+** \param     blockSize The size of each block in bytes.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there is no
+**            more space available on the heap to statically preallocated the blocks.
 **
 ****************************************************************************************/
-void TbxMemPoolRelease(void * memPtr)
+uint8_t TbxMemPoolGrow(size_t blockSize)
 {
-  void            * blockPtr;
+  uint8_t           result = TBX_ERROR;
+  size_t            numBlocks;
+  size_t            growthBlocks = TBX_CONF_MEMPOOL_GROWTH_BLOCKS;
+  uint8_t           growthPolicy = TBX_CONF_MEMPOOL_GROWTH_POLICY;
+  size_t            currentBlocks = 0U;
   tPoolNode const * poolNodePtr;
 
   /* Verify parameter. */
-  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(blockSize > 0U);
 
   /* Only continue if the parameter is valid. */
-  if (memPtr != NULL)
+  if (blockSize > 0U)
   {
     /* Obtain mutual exclusive access to the memory pool list. */
     TbxCriticalSectionEnter();
-    /* First convert the block's data pointer to the block's base memory pointer. */
-    blockPtr = TbxMemPoolBlockGetMemPtr(memPtr);
-    /* Only continue if the block pointer is valid. */
-    if (blockPtr != NULL)
+    /* Attempt to locate the memory pool with the exact same block size. */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Use its growth policy and its current number of blocks, if it exists. */
+    if (poolNodePtr != NULL)
     {
-      /* Get the block's data size. */
-      size_t blockSize = TbxMemPoolBlockGetBlockSize(blockPtr);
-      /* Attempt to locate the memory pool node that holds the memory pool with this
-       * block size.
-       */
-      poolNodePtr = TbxMemPoolListFind(blockSize);
-      /* Sanity check. The memory pool node that the to be released memory originally
-       * belonged to should have been found.
-       */
-      TBX_ASSERT(poolNodePtr != NULL);
-      /* Only continue if the sanity check passed. */
-      if (poolNodePtr != NULL)
-      {
-        /* Get the pointer to the actual memory pool. */
-        tPool const * poolPtr = poolNodePtr->poolPtr;
-        /* Sanity check. The memory pool should not be NULL here. */
-        TBX_ASSERT(poolPtr != NULL);
-        /* Only continue if the sanity check passed. */
-        if (poolPtr != NULL)
-        {
-          /* Attempt to extract a block node from the linked list with used block
-           * nodes.
-           */
-          tBlockNode * blockNodePtr = TbxMemPoolBlockListExtract(poolPtr->usedBlockListPtr);
-          /* Sanity check. A node should be available, otherwise more blocks were
-           * released than actually allocated, which shouldn't happen.
-           */
-          TBX_ASSERT(blockNodePtr != NULL);
-          /* Only continue if a block node could be extracted. */
-          if (blockNodePtr != NULL)
-          {
-            /* Initialize the block. */
-            blockNodePtr->blockPtr = blockPtr;
-            /* Now the node itself needs to be inserted into the linked list with free
-             * block nodes. This way this node can be allocated again in the future.
-             */
-            TbxMemPoolBlockListInsert(poolPtr->freeBlockListPtr, blockNodePtr);
-          }
-        }
-      }
+      growthPolicy = poolNodePtr->poolPtr->growthPolicy;
+      growthBlocks = poolNodePtr->poolPtr->growthBlocks;
+      currentBlocks = poolNodePtr->poolPtr->numBlocks;
     }
     /* Release mutual exclusive access to the memory pool list. */
     TbxCriticalSectionExit();
+    /* Determine the number of blocks to add, based on the growth policy. */
+    if (growthPolicy == TBX_MEMPOOL_GROWTH_DOUBLE)
+    {
+      /* Add as many blocks as the memory pool currently has, but at least one. */
+      numBlocks = (currentBlocks > 0U) ? currentBlocks : 1U;
+      /* Limit the number of blocks, if a maximum is configured. */
+      if ( (growthBlocks > 0U) && (numBlocks > growthBlocks) )
+      {
+        numBlocks = growthBlocks;
+      }
+    }
+    else
+    {
+      /* Add a fixed number of blocks. */
+      numBlocks = growthBlocks;
+    }
+    /* Expand the memory pool, or create it if it does not yet exist. */
+    result = TbxMemPoolCreate(numBlocks, blockSize);
+    /* Try again with just one block, if there was not enough space on the heap. */
+    if ( (result != TBX_OK) && (numBlocks > 1U) )
+    {
+      result = TbxMemPoolCreate(1U, blockSize);
+    }
   }
-} /*** end of TbxMemPoolRelease ***/
 
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGrow ***/
 
-/****************************************************************************************
-*   P O O L   L I S T   M A N A G E M E N T   F U N C T I O N S
-****************************************************************************************/
 
 /************************************************************************************//**
-** \brief     Searches through the linked list with memory pools to find a pool that was
-**            created to hold blocks that are of the exact size as specified by the
-**            parameter.
-** \param     blockSize Size of the blocks managed by the memory pool.
-** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+** \brief     Configures the growth policy of the memory pool with the specified block
+**            size. It determines by how many blocks TbxMemPoolGrow() and
+**            TbxMemPoolAllocateAuto() expand the memory pool.
+** \param     blockSize The size of each block in bytes, which identifies the memory pool.
+**            The memory pool must already exist.
+** \param     policy The growth policy. Either TBX_MEMPOOL_GROWTH_FIXED to add a fixed
+**            number of blocks with each expansion, or TBX_MEMPOOL_GROWTH_DOUBLE to double
+**            the number of blocks with each expansion.
+** \param     numBlocks With TBX_MEMPOOL_GROWTH_FIXED, the number of blocks to add with
+**            each expansion. With TBX_MEMPOOL_GROWTH_DOUBLE, the maximum number of blocks
+**            to add with each expansion, where 0 means no maximum.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static tPoolNode * TbxMemPoolListFind(size_t blockSize)
+uint8_t TbxMemPoolSetGrowth(size_t  blockSize,
+                            uint8_t policy,
+                            size_t  numBlocks)
 {
-  tPoolNode * result = NULL;
-  tPoolNode * poolNodePtr;
+  uint8_t           result = TBX_ERROR;
+  tPoolNode const * poolNodePtr;
 
-  /* Verify parameter. */
+  /* Verify parameters. */
   TBX_ASSERT(blockSize > 0U);
+  TBX_ASSERT( (policy == TBX_MEMPOOL_GROWTH_DOUBLE) ||
+              ((policy == TBX_MEMPOOL_GROWTH_FIXED) && (numBlocks > 0U)) );
 
-  /* Only continue if the parameter is valid. */
-  if (blockSize > 0U)
+  /* Only continue if the parameters are valid. */
+  if ( (blockSize > 0U) &&
+       ( (policy == TBX_MEMPOOL_GROWTH_DOUBLE) ||
+         ((policy == TBX_MEMPOOL_GROWTH_FIXED) && (numBlocks > 0U)) ) )
   {
-    /* Get pointer to the pool node at the head of the linked list. */
-    poolNodePtr = tbxPoolList;
-    /* Loop through all nodes until a match is found. */
-    while (poolNodePtr != NULL)
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxCriticalSectionEnter();
+    /* Attempt to locate the memory pool with the exact same block size. */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Only continue if the memory pool exists. */
+    if (poolNodePtr != NULL)
+    {
+      /* Store the growth policy. */
+      poolNodePtr->poolPtr->growthPolicy = policy;
+      poolNodePtr->poolPtr->growthBlocks = numBlocks;
+      /* Update the result. */
+      result = TBX_OK;
+    }
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolSetGrowth ***/
+
+
+/************************************************************************************//**
+** \brief     Shrinks the memory pool with the specified block size, by releasing its
+**            slabs of which all blocks are free. A slab holds the blocks that were added
+**            to the memory pool in one go, for example with one call to
+**            TbxMemPoolCreate() or TbxMemPoolGrow(). The memory of a released slab is
+**            reused for the blocks that are added to any memory pool afterwards, before
+**            memory is taken from the heap. This prevents that memory remains stuck in
+**            the memory pool of a block size, after a temporary peak in allocations of
+**            that block size.
+** \details   The free blocks of the memory pool cannot be allocated while this function
+**            runs and the check of the slabs happens in the critical section. It is
+**            therefore best called at a quiet moment, for example from a low priority
+**            task. Blocks cached in the magazine of a thread do not count as free blocks.
+**            Call TbxMemPoolMagazineFlush() beforehand, to include these.
+** \param     blockSize The size of each block in bytes, which identifies the memory pool.
+** \param     keepBlocks Number of free blocks that the memory pool should at least keep.
+**            This makes it possible to only release memory beyond a watermark.
+** \return    The number of blocks that were released.
+**
+****************************************************************************************/
+size_t TbxMemPoolShrink(size_t blockSize,
+                        size_t keepBlocks)
+{
+  size_t            result = 0U;
+  size_t            freeBlocks;
+  size_t            slabBlocks;
+  void            * firstBlockPtr = NULL;
+  void            * lastBlockPtr = NULL;
+  tSlab           * slabPtr;
+  tSlab           * prevSlabPtr = NULL;
+  tSlab           * nextSlabPtr;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (blockSize > 0U)
+  {
+    /* Attempt to locate the memory pool with the exact same block size. */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Only continue if the memory pool exists. */
+    if (poolNodePtr != NULL)
+    {
+      /* Get the pointer to the actual memory pool. */
+      tPool * poolPtr = poolNodePtr->poolPtr;
+      /* Take all free blocks out of the linked list with free blocks, such that no
+       * other thread can allocate them while the slabs are checked.
+       */
+      freeBlocks = TbxMemPoolBlockListExtractChain(poolPtr, (size_t)-1, &firstBlockPtr,
+                                                   &lastBlockPtr);
+      /* Obtain mutual exclusive access to the slabs. */
+      TbxCriticalSectionEnter();
+      /* Loop through the slabs of the memory pool. */
+      slabPtr = poolPtr->slabListPtr;
+      while (slabPtr != NULL)
+      {
+        /* Store the next slab, because a released slab is linked into another list. */
+        nextSlabPtr = slabPtr->nextSlabPtr;
+        /* Determine the number of blocks in the slab. */
+        slabBlocks = slabPtr->numBlocks;
+        /* Can the slab be released without going below the number of blocks to keep and
+         * are all its blocks free?
+         */
+        if ( (freeBlocks >= keepBlocks) && ((freeBlocks - keepBlocks) >= slabBlocks) &&
+             (TbxMemPoolSlabCountBlocks(slabPtr, firstBlockPtr, freeBlocks) ==
+              slabBlocks) )
+        {
+          /* Remove its blocks from the free blocks. */
+          freeBlocks = TbxMemPoolSlabRemoveBlocks(slabPtr, &firstBlockPtr, &lastBlockPtr,
+                                                  freeBlocks);
+          /* Remove the slab from the memory pool. */
+          if (prevSlabPtr == NULL)
+          {
+            poolPtr->slabListPtr = nextSlabPtr;
+          }
+          else
+          {
+            prevSlabPtr->nextSlabPtr = nextSlabPtr;
+          }
+          poolPtr->numBlocks -= slabBlocks;
+          result += slabBlocks;
+          /* Add the slab to the released slabs, such that its memory can be reused. */
+          TbxMemPoolSlabRelease(slabPtr);
+        }
+        else
+        {
+          /* The slab stays, so it becomes the previous one of the next slab. */
+          prevSlabPtr = slabPtr;
+        }
+        /* Continue with the next slab. */
+        slabPtr = nextSlabPtr;
+      }
+      /* Release mutual exclusive access to the slabs. */
+      TbxCriticalSectionExit();
+      /* Give the remaining free blocks back to the memory pool. */
+      if (freeBlocks > 0U)
+      {
+        TbxMemPoolBlockListInsert(poolPtr, firstBlockPtr, lastBlockPtr);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolShrink ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the previously allocated block of memory. Once the memory is
+**            released, it can be allocated again afterwards with function
+**            TbxMemPoolAllocate(). Note that this function automatically finds the
+**            memory pool that the memory block belongs to. Each block stores a pointer
+**            to its memory pool, so this takes the same time regardless of the number
+**            of memory pools.
+** \param     memPtr Pointer to the start of the memory block. Basically, the pointer
+**            that was returned by function TbxMemPoolAllocate(), when the memory was
+**            initially allocated.
+**
+****************************************************************************************/
+void TbxMemPoolRelease(void * memPtr)
+{
+  void  * blockPtr;
+  tPool * poolPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
+  {
+    /* First convert the block's data pointer to the block's base memory pointer. */
+    blockPtr = TbxMemPoolBlockGetMemPtr(memPtr);
+    /* Only continue if the block pointer is valid. */
+    if (blockPtr != NULL)
+    {
+      /* Get the memory pool that the block belongs to, directly from the block. */
+      poolPtr = TbxMemPoolBlockGetPool(blockPtr);
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+      /* With assertions enabled, also verify that it is an existing memory pool. This
+       * catches attempts to release memory that was not allocated from a memory pool.
+       * It walks the list with memory pools, so it is skipped otherwise.
+       */
+      if (TbxMemPoolListContains(poolPtr) == TBX_FALSE)
+      {
+        poolPtr = NULL;
+      }
+#endif
+      /* Sanity check. The memory pool that the to be released memory originally
+       * belonged to should have been found.
+       */
+      TBX_ASSERT(poolPtr != NULL);
+      /* Only continue if the sanity check passed. */
+      if (poolPtr != NULL)
+      {
+        /* Release the block to its memory pool. */
+        TbxMemPoolReleaseInternal(poolPtr, blockPtr);
+      }
+    }
+  }
+} /*** end of TbxMemPoolRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Changes the size of a previously allocated block of memory. If the block
+**            is already large enough for the new size, it is kept as is and the same
+**            pointer is returned. This is the case as long as the new size does not
+**            exceed the block size of its memory pool. Otherwise a block is allocated in
+**            the memory pool that best fits the new size, in the same way as with
+**            TbxMemPoolAllocate(). The contents of the original block are copied to the
+**            new block, after which the original block is released.
+** \details   Handy for buffers that grow incrementally. Most of the time, the growth
+**            still fits in the block that is already allocated, in which case this
+**            function neither allocates nor copies.
+** \param     memPtr Pointer to the start of the memory block. Basically, the pointer
+**            that was returned by function TbxMemPoolAllocate(), when the memory was
+**            initially allocated. If NULL, it simply allocates new memory.
+** \param     size The new number of bytes for the memory block.
+** \return    Pointer to the start of the memory block if successful, NULL otherwise. In
+**            case of an error, the original block is kept as is and it is not released.
+**
+****************************************************************************************/
+void * TbxMemPoolReallocate(void   * memPtr,
+                            size_t   size)
+{
+  void  * result = NULL;
+  void  * blockPtr;
+  tPool * poolPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (size > 0U)
+  {
+    /* No memory allocated yet? */
+    if (memPtr == NULL)
+    {
+      /* Simply allocate new memory. */
+      result = TbxMemPoolAllocate(size);
+    }
+    else
+    {
+      /* First convert the block's data pointer to the block's base memory pointer. */
+      blockPtr = TbxMemPoolBlockGetMemPtr(memPtr);
+      /* Get the memory pool that the block belongs to, directly from the block. */
+      poolPtr = TbxMemPoolBlockGetPool(blockPtr);
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+      /* With assertions enabled, also verify that it is an existing memory pool. This
+       * catches attempts to reallocate memory that was not allocated from a memory pool.
+       * It walks the list with memory pools, so it is skipped otherwise.
+       */
+      if (TbxMemPoolListContains(poolPtr) == TBX_FALSE)
+      {
+        poolPtr = NULL;
+      }
+#endif
+      /* Sanity check. The memory pool that the memory belongs to should have been
+       * found.
+       */
+      TBX_ASSERT(poolPtr != NULL);
+      /* Only continue if the sanity check passed. */
+      if (poolPtr != NULL)
+      {
+        /* Does the new size still fit in the block? */
+        if (size <= poolPtr->blockSize)
+        {
+          /* Keep the block as is. */
+          result = memPtr;
+        }
+        else
+        {
+          /* Attempt to allocate a block in the memory pool that best fits the new size. */
+          result = TbxMemPoolAllocate(size);
+          /* Only continue if the allocation was successful. */
+          if (result != NULL)
+          {
+            /* Copy the contents of the original block to the new block. Only the bytes
+             * that fit in the original block can hold data.
+             */
+            TbxMemPoolBlockCopy(result, memPtr, poolPtr->blockSize);
+            /* Release the original block to its memory pool. */
+            TbxMemPoolReleaseInternal(poolPtr, blockPtr);
+          }
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolReallocate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the handle of the memory pool that TbxMemPoolAllocate() would
+**            allocate from, for the specified number of bytes. Software that always
+**            allocates the same type, can look up its memory pool once with this
+**            function. Afterwards, it can allocate and release blocks with
+**            TbxMemPoolAllocateFrom() and TbxMemPoolReleaseTo(), which skip the lookup of
+**            the memory pool. Note that the handle stays valid for as long as the
+**            software program runs, because memory pools are never deleted. Expanding
+**            or shrinking the memory pool does not change its handle.
+** \param     size The number of bytes that will be allocated in the memory pool.
+** \return    Handle of the best fitting memory pool if successful, NULL otherwise.
+**
+****************************************************************************************/
+tTbxMemPool * TbxMemPoolGetHandle(size_t size)
+{
+  tTbxMemPool     * result = NULL;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (size > 0U)
+  {
+    /* Find the best fitting memory pool, in the same way as TbxMemPoolAllocate(). */
+    poolNodePtr = TbxMemPoolListLookup(size);
+    /* Only continue if a memory pool candidate was found. */
+    if (poolNodePtr != NULL)
+    {
+      /* The memory pool itself serves as the handle. */
+      result = poolNodePtr->poolPtr;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGetHandle ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to allocate a block in the memory pool with the specified handle.
+**            Works the same as TbxMemPoolAllocate(), except that it does not need to
+**            look up the memory pool. Allocating then comes down to extracting the first
+**            block from the free block list.
+** \param     pool Handle of the memory pool, as obtained with TbxMemPoolGetHandle().
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxMemPoolAllocateFrom(tTbxMemPool * pool)
+{
+  void  * result = NULL;
+  tPool * poolPtr = pool;
+
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+  /* With assertions enabled, also verify that the handle refers to an existing memory
+   * pool. It walks the list with memory pools, so it is skipped otherwise.
+   */
+  if ( (poolPtr != NULL) && (TbxMemPoolListContains(poolPtr) == TBX_FALSE) )
+  {
+    poolPtr = NULL;
+  }
+#endif
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+    /* Attempt to allocate a block from the memory pool. */
+    result = TbxMemPoolAllocateInternal(poolPtr, TBX_TRUE);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolAllocateFrom ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the previously allocated block of memory to the memory pool with
+**            the specified handle. Works the same as TbxMemPoolRelease(), except that it
+**            does not need to read the memory pool from the block. Releasing then comes
+**            down to inserting the block at the start of the free block list.
+** \param     pool Handle of the memory pool, as obtained with TbxMemPoolGetHandle().
+** \param     memPtr Pointer to the start of the memory block. Basically, the pointer
+**            that was returned by function TbxMemPoolAllocateFrom(), when the memory was
+**            initially allocated.
+**
+****************************************************************************************/
+void TbxMemPoolReleaseTo(tTbxMemPool * pool,
+                         void        * memPtr)
+{
+  void * blockPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((pool != NULL) && (memPtr != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((pool != NULL) && (memPtr != NULL))
+  {
+    /* First convert the block's data pointer to the block's base memory pointer. */
+    blockPtr = TbxMemPoolBlockGetMemPtr(memPtr);
+    /* Only continue if the block pointer is valid. */
+    if (blockPtr != NULL)
+    {
+      /* Sanity check. The block should belong to the memory pool of the handle. */
+      TBX_ASSERT(TbxMemPoolBlockGetPool(blockPtr) == pool);
+      /* Only continue if the sanity check passed. */
+      if (TbxMemPoolBlockGetPool(blockPtr) == pool)
+      {
+        /* Release the block to the memory pool. */
+        TbxMemPoolReleaseInternal(pool, blockPtr);
+      }
+    }
+  }
+} /*** end of TbxMemPoolReleaseTo ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to allocate a batch of blocks for the desired number of bytes, in a
+**            previously created memory pool. The blocks are allocated in the memory pool
+**            that best fits the requested byte size, in the same way as with
+**            TbxMemPoolAllocate(). However, the memory pool is looked up just once for
+**            all blocks. On ports without support for tagged atomic operations, the
+**            blocks are extracted from its free block list with just one lock of the
+**            list. On ports with support for tagged atomic operations, the blocks are
+**            popped from the list one by one, each lock-free. Handy for filling a
+**            receive ring buffer, for example.
+** \param     size The number of bytes to allocate for each block.
+** \param     ptrs Array where the pointers to the start of the newly allocated memory
+**            blocks are written to.
+** \param     count Number of blocks to allocate. The array should have at least this
+**            many entries.
+** \return    The number of blocks that were allocated. Less than count if the memory pool
+**            did not have enough free blocks. Only this many entries of the array are
+**            written to.
+**
+****************************************************************************************/
+size_t TbxMemPoolAllocateBatch(size_t   size,
+                               void   * ptrs[],
+                               size_t   count)
+{
+  size_t            result = 0U;
+  size_t            numBlocks;
+  void            * blockPtr = NULL;
+  void            * lastBlockPtr;
+  void           ** nextBlockPtr;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(size > 0U);
+  TBX_ASSERT(ptrs != NULL);
+  TBX_ASSERT(count > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (size > 0U) && (ptrs != NULL) && (count > 0U) )
+  {
+    /* Find the best fitting memory pool, just once for all blocks. */
+    poolNodePtr = TbxMemPoolListLookup(size);
+    /* Only continue with the allocation of a memory pool candidate was found. */
+    if (poolNodePtr != NULL)
+    {
+      /* Get the pointer to the actual memory pool. */
+      tPool * poolPtr = poolNodePtr->poolPtr;
+      /* Sanity check. The memory pool should not be NULL here. */
+      TBX_ASSERT(poolPtr != NULL);
+      /* Only continue if the sanity check passed. */
+      if (poolPtr != NULL)
+      {
+        /* Extract the blocks from the linked list with free blocks. They are linked
+         * together afterwards.
+         */
+        numBlocks = TbxMemPoolBlockListExtractChain(poolPtr, count, &blockPtr,
+                                                    &lastBlockPtr);
+        /* Hand out the blocks in the order of the chain. */
+        while (result < numBlocks)
+        {
+          /* The pointer to the next block is stored at the start of the block's data. */
+          nextBlockPtr = TbxMemPoolBlockGetDataPtr(blockPtr);
+          blockPtr = *nextBlockPtr;
+          /* Store the pointer to the block's data. */
+          ptrs[result] = nextBlockPtr;
+          result++;
+        }
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+        /* The magazine of the calling thread might still hold free blocks. Use these
+         * for the remainder of the batch.
+         */
+        while (result < count)
+        {
+          /* Attempt to allocate a block through the magazine. */
+          blockPtr = TbxMemPoolMagazineAllocate(poolPtr);
+          /* Stop if there are no more free blocks. */
+          if (blockPtr == NULL)
+          {
+            break;
+          }
+          /* Store the pointer to the block's data. */
+          ptrs[result] = TbxMemPoolBlockGetDataPtr(blockPtr);
+          result++;
+        }
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+        /* Account for the allocation in the statistics, also if it fell short. */
+        TbxMemPoolStatsAllocated(poolPtr, result, count);
+#endif
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolAllocateBatch ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a batch of previously allocated blocks of memory. Successive blocks
+**            that belong to the same memory pool are linked together and inserted into
+**            its free block list with just one update. So releasing a batch of blocks
+**            of one memory pool costs about the same as releasing one block.
+** \param     ptrs Array with the pointers to the start of the memory blocks. Basically,
+**            the pointers that were returned by TbxMemPoolAllocate() or
+**            TbxMemPoolAllocateBatch(), when the memory was initially allocated.
+** \param     count Number of blocks in the array to release.
+**
+****************************************************************************************/
+void TbxMemPoolReleaseBatch(void   * ptrs[],
+                            size_t   count)
+{
+  size_t    idx;
+  size_t    chainBlocks = 0U;
+  void   *  blockPtr;
+  void   *  firstBlockPtr = NULL;
+  void   *  lastBlockPtr = NULL;
+  void   ** nextBlockPtr;
+  tPool  *  poolPtr;
+  tPool  *  chainPoolPtr = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ptrs != NULL);
+  TBX_ASSERT(count > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ptrs != NULL) && (count > 0U) )
+  {
+    /* Loop over all blocks to release. */
+    for (idx = 0U; idx < count; idx++)
+    {
+      /* Verify the entry. */
+      TBX_ASSERT(ptrs[idx] != NULL);
+      /* Only continue if the entry is valid. */
+      if (ptrs[idx] != NULL)
+      {
+        /* First convert the block's data pointer to the block's base memory pointer. */
+        blockPtr = TbxMemPoolBlockGetMemPtr(ptrs[idx]);
+        /* Get the memory pool that the block belongs to, directly from the block. */
+        poolPtr = TbxMemPoolBlockGetPool(blockPtr);
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+        /* With assertions enabled, also verify that it is an existing memory pool. Only
+         * needed if it differs from the one of the previous block.
+         */
+        if ( (poolPtr != chainPoolPtr) && (TbxMemPoolListContains(poolPtr) == TBX_FALSE) )
+        {
+          poolPtr = NULL;
+        }
+#endif
+        /* Sanity check. The memory pool that the to be released memory originally
+         * belonged to should have been found.
+         */
+        TBX_ASSERT(poolPtr != NULL);
+        /* Only continue if the sanity check passed. */
+        if (poolPtr != NULL)
+        {
+          /* Does the block belong to another memory pool than the chain so far? */
+          if (poolPtr != chainPoolPtr)
+          {
+            /* Insert the chain so far into the free block list of its memory pool. */
+            if (chainBlocks > 0U)
+            {
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+              /* Account for the release in the statistics. */
+              TbxMemPoolStatsReleased(chainPoolPtr, chainBlocks);
+#endif
+              TbxMemPoolBlockListInsert(chainPoolPtr, firstBlockPtr, lastBlockPtr);
+            }
+            /* Start a new chain for this memory pool. */
+            chainPoolPtr = poolPtr;
+            chainBlocks = 0U;
+          }
+          /* Add the block at the end of the chain. */
+          if (chainBlocks == 0U)
+          {
+            firstBlockPtr = blockPtr;
+          }
+          else
+          {
+            /* The pointer to the next block is stored at the start of the block's
+             * data.
+             */
+            nextBlockPtr = TbxMemPoolBlockGetDataPtr(lastBlockPtr);
+            *nextBlockPtr = blockPtr;
+          }
+          lastBlockPtr = blockPtr;
+          chainBlocks++;
+        }
+      }
+    }
+    /* Insert the last chain into the free block list of its memory pool. */
+    if (chainBlocks > 0U)
+    {
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+      /* Account for the release in the statistics. */
+      TbxMemPoolStatsReleased(chainPoolPtr, chainBlocks);
+#endif
+      TbxMemPoolBlockListInsert(chainPoolPtr, firstBlockPtr, lastBlockPtr);
+    }
+  }
+} /*** end of TbxMemPoolReleaseBatch ***/
+
+
+/************************************************************************************//**
+** \brief     Moves the free blocks that the calling thread cached in its magazines,
+**            back to their memory pools. Only needed when TBX_CONF_MEMPOOL_MAGAZINE_SIZE
+**            is enabled. Call it right before a thread ends, otherwise its cached blocks
+**            are lost. It can also be called when a thread becomes idle, such that other
+**            threads can allocate the blocks.
+**
+****************************************************************************************/
+void TbxMemPoolMagazineFlush(void)
+{
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+  /* Loop over all magazines of the calling thread. */
+  for (size_t indexIdx = 0U; indexIdx < TBX_MEMPOOL_INDEX_COUNT; indexIdx++)
+  {
+    /* Give its blocks back to their memory pool. */
+    TbxMemPoolMagazineEmpty(&tbxPoolMagazines[indexIdx]);
+  }
+#endif
+} /*** end of TbxMemPoolMagazineFlush ***/
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Obtains the statistics of the memory pool with the specified block size.
+**            This makes it possible to tune the number of blocks to create for each
+**            memory pool, or to detect that a memory pool is about to run out of free
+**            blocks. Note that blocks cached in the magazine of a thread, count as free
+**            blocks.
+** \param     blockSize The size of each block in bytes, which identifies the memory pool.
+** \param     stats Pointer to where the statistics are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when the memory pool
+**            does not exist.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolGetStats(size_t             blockSize,
+                           tTbxMemPoolStats * stats)
+{
+  uint8_t           result = TBX_ERROR;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(blockSize > 0U);
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (blockSize > 0U) && (stats != NULL) )
+  {
+    /* Attempt to locate the memory pool with the exact same block size. */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Only continue if the memory pool exists. */
+    if (poolNodePtr != NULL)
+    {
+      /* Read out its statistics. */
+      TbxMemPoolStatsRead(poolNodePtr->poolPtr, stats);
+      /* Update the result. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Calls the specified handler with the statistics of each memory pool, in the
+**            order of ascending block size. Refer to TbxMemPoolGetStats() for details.
+** \param     handler Function that is called with the statistics of each memory pool.
+**
+****************************************************************************************/
+void TbxMemPoolWalkStats(tTbxMemPoolStatsHandler handler)
+{
+  tTbxMemPoolStats   stats;
+  tPoolNode const  * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(handler != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (handler != NULL)
+  {
+    /* Memory pool nodes are never removed from the list, so it can be walked without
+     * holding a lock in between the nodes.
+     */
+    poolNodePtr = TbxMemPoolListLoad(&tbxPoolList);
+    while (poolNodePtr != NULL)
+    {
+      /* Read out the statistics of this memory pool and pass them on to the handler. */
+      TbxMemPoolStatsRead(poolNodePtr->poolPtr, &stats);
+      handler(&stats);
+      /* Continue with the next pool node in the list. */
+      poolNodePtr = TbxMemPoolListLoad(&poolNodePtr->nextNodePtr);
+    }
+  }
+} /*** end of TbxMemPoolWalkStats ***/
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
+
+
+/****************************************************************************************
+*   P O O L   C R E A T I O N   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Creates a new memory pool with the specified number of blocks, or extends
+**            the already existing memory pool with the same block size. Refer to
+**            TbxMemPoolCreate() and TbxMemPoolCreateAligned() for details.
+** \param     numBlocks The number of blocks to statically preallocate on the heap for
+**            this memory pool.
+** \param     blockSize The size of each block in bytes.
+** \param     alignment Desired alignment of the data of each block in bytes, as a power
+**            of two. Alignments below the address size are raised to the address size.
+**            Set to 0 to keep the alignment of an already existing memory pool.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxMemPoolCreateInternal(size_t numBlocks,
+                                        size_t blockSize,
+                                        size_t alignment)
+{
+  uint8_t      result = TBX_ERROR;
+  uint8_t    * slabPtr;
+  tSlab      * slabHeaderPtr;
+  size_t       slabSize;
+  size_t       slabOffset;
+  size_t       blockStride;
+  size_t       blockIdx;
+  size_t       poolAlignment = alignment;
+  tPool      * poolPtr;
+  tPoolNode  * poolNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(numBlocks > 0U);
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (numBlocks > 0U) && (blockSize > 0U) )
+  {
+    /* Set the result value to okay. */
+    result = TBX_OK;
+    /* The data of each block is at least aligned to the address size. */
+    if (poolAlignment < sizeof(void *))
+    {
+      poolAlignment = sizeof(void *);
+    }
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxCriticalSectionEnter();
+    /* Attempt to locate a memory pool node in the list that is configured for the same
+     * block size.
+     */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Create a new memory pool node and its associated empty memory pool if a memory
+     * pool node for this block size does not yet exist.
+     */
+    if (poolNodePtr == NULL)
+    {
+      /* Create a new memory pool node. */
+      poolNodePtr = TbxHeapAllocate(sizeof(tPoolNode));
+      /* Verify that the memory pool node could be created. */
+      if (poolNodePtr == NULL)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      /* Continue with creating the memory pool object. */
+      else
+      {
+        /* Create a new memory pool object. */
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+        /* Its tagged pointer must be aligned to its size. */
+        poolPtr = TbxHeapAllocateAligned(sizeof(tPool), sizeof(tTbxPortTaggedPtr));
+#else
+        poolPtr = TbxHeapAllocate(sizeof(tPool));
+#endif
+        /* Verify that the memory pool object could be created. */
+        if (poolPtr == NULL)
+        {
+          /* Flag the error. */
+          result = TBX_ERROR;
+        }
+        /* Continue with initializing both the memory pool and its node. */
+        else
+        {
+          /* Initialize the memory pool node. */
+          poolNodePtr->nextNodePtr = NULL;
+          poolNodePtr->poolPtr = poolPtr;
+          /* Store the data size and alignment of the blocks managed by the memory
+           * pool.
+           */
+          poolPtr->blockSize = blockSize;
+          poolPtr->alignment = poolAlignment;
+          /* The blocks are added later on. */
+          poolPtr->numBlocks = 0U;
+          poolPtr->slabListPtr = NULL;
+          /* Configure the default growth policy. */
+          poolPtr->growthPolicy = TBX_CONF_MEMPOOL_GROWTH_POLICY;
+          poolPtr->growthBlocks = TBX_CONF_MEMPOOL_GROWTH_BLOCKS;
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+          /* Reset the statistics. */
+          poolPtr->usedBlocks = 0U;
+          poolPtr->peakUsedBlocks = 0U;
+          poolPtr->failedAllocs = 0U;
+#endif
+          /* Initialize the linked list with free blocks to be empty. */
+          TbxMemPoolBlockListInit(poolPtr);
+          /* The (empty) memory pool and its node were created. Time to insert it into
+           * the list.
+           */
+          TbxMemPoolListInsert(poolNodePtr);
+        }
+      }
+    }
+    /* An existing memory pool cannot be extended with blocks of a larger alignment,
+     * because its existing blocks do not have that alignment.
+     */
+    else if (alignment > poolNodePtr->poolPtr->alignment)
+    {
+      /* Flag the error. */
+      result = TBX_ERROR;
+    }
+    /* Extend the existing memory pool with blocks of its own alignment. */
+    else
+    {
+      poolAlignment = poolNodePtr->poolPtr->alignment;
+    }
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxCriticalSectionExit();
+
+    /* Only continue if all is okay so far. */
+    if (result == TBX_OK)
+    {
+      /* The pool node pointer it now valid. It either points to a node that holds a
+       * newly created and empty memory pool or to a node that holds an already existing
+       * memory pool that can be extended. Allocate the memory for all blocks at once,
+       * as one contiguous slab. The slab starts with its header, followed by a few
+       * unused bytes, such that the data after the memory pool pointer of the first
+       * block is aligned.
+       */
+      blockStride = TbxMemPoolBlockGetStride(blockSize, poolAlignment);
+      slabOffset = TbxMemPoolSlabGetOffset(poolAlignment);
+      slabSize = 0U;
+      slabPtr = NULL;
+      /* Only allocate if the size of the slab can be represented. */
+      if (numBlocks <= ((((size_t)-1) - slabOffset) / blockStride))
+      {
+        slabSize = slabOffset + (numBlocks * blockStride);
+        slabPtr = TbxMemPoolSlabAllocate(&slabSize, poolAlignment);
+      }
+      /* Verify that the slab could be allocated. */
+      if (slabPtr == NULL)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      /* Sanity check. The pool node pointer should not be NULL here. */
+      else if (poolNodePtr == NULL)
+      {
+        /* Flag the error. */
+        TBX_ASSERT(poolNodePtr != NULL);
+        result = TBX_ERROR;
+      }
+      /* Carve the blocks out of the slab and add them to the free block list. */
+      else
+      {
+        /* Initialize the slab header. */
+        slabHeaderPtr = (tSlab *)(void *)slabPtr;
+        slabHeaderPtr->size = slabSize;
+        slabHeaderPtr->numBlocks = numBlocks;
+        /* Skip the header and the unused bytes at the start of the slab. */
+        slabPtr = &slabPtr[slabOffset];
+        /* Account for the new blocks and the slab in the memory pool. */
+        TbxCriticalSectionEnter();
+        poolNodePtr->poolPtr->numBlocks += numBlocks;
+        slabHeaderPtr->nextSlabPtr = poolNodePtr->poolPtr->slabListPtr;
+        poolNodePtr->poolPtr->slabListPtr = slabHeaderPtr;
+        TbxCriticalSectionExit();
+        /* Initialize the blocks and link them together by ascending address, such that
+         * the blocks are handed out by ascending address. The slab is not yet shared, so
+         * no locking is needed for this.
+         */
+        for (blockIdx = 0U; blockIdx < numBlocks; blockIdx++)
+        {
+          /* Initialize the block. */
+          TbxMemPoolBlockInit(&slabPtr[blockIdx * blockStride], poolNodePtr->poolPtr);
+          /* Link the previous block to this one. */
+          if (blockIdx > 0U)
+          {
+            void ** nextBlockPtr;
+            nextBlockPtr = TbxMemPoolBlockGetDataPtr(&slabPtr[(blockIdx - 1U) *
+                                                              blockStride]);
+            *nextBlockPtr = &slabPtr[blockIdx * blockStride];
+          }
+        }
+        /* Insert all the linked blocks into the free block list at once. */
+        TbxMemPoolBlockListInsert(poolNodePtr->poolPtr, slabPtr,
+                                  &slabPtr[(numBlocks - 1U) * blockStride]);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolCreateInternal ***/
+
+
+/****************************************************************************************
+*   P O O L   A C C E S S   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Attempts to allocate a block in the specified memory pool. With magazines
+**            enabled, the block is allocated through the magazine of the calling thread.
+**            Otherwise it is extracted directly from the free block list of the memory
+**            pool.
+** \param     poolPtr Pointer to the memory pool.
+** \param     countFailure TBX_TRUE to count a failed allocation in the statistics.
+**            TBX_FALSE if the caller attempts the allocation again after a failure, in
+**            which case only that attempt should count.
+** \return    Pointer to the data of the newly allocated block if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+static void * TbxMemPoolAllocateInternal(tPool   * poolPtr,
+                                         uint8_t   countFailure)
+{
+  void * result = NULL;
+  void * blockPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+    /* Attempt to allocate a block through the magazine of the calling thread. */
+    blockPtr = TbxMemPoolMagazineAllocate(poolPtr);
+#else
+    /* Attempt to extract a block from the linked list with free blocks. */
+    blockPtr = TbxMemPoolBlockListExtract(poolPtr);
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+    /* Account for the allocation in the statistics. A failed allocation only counts as
+     * such, if requested.
+     */
+    if ( (blockPtr != NULL) || (countFailure == TBX_TRUE) )
+    {
+      TbxMemPoolStatsAllocated(poolPtr, (blockPtr != NULL) ? 1U : 0U, 1U);
+    }
+#else
+    /* Failed allocations are only counted in the statistics. */
+    (void)countFailure;
+#endif
+    /* Only continue if a free block could be extracted. */
+    if (blockPtr != NULL)
+    {
+      /* Read and store the pointer that points to the block's data. */
+      result = TbxMemPoolBlockGetDataPtr(blockPtr);
+      /* Perform a sanity check. The block's data pointer should not be NULL here. */
+      TBX_ASSERT(result != NULL);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolAllocateInternal ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the block to the specified memory pool. With magazines enabled,
+**            the block is released into the magazine of the calling thread. Otherwise it
+**            is inserted directly into the free block list of the memory pool.
+** \param     poolPtr Pointer to the memory pool that the block belongs to.
+** \param     blockPtr Pointer to the block's base memory.
+**
+****************************************************************************************/
+static void TbxMemPoolReleaseInternal(tPool * poolPtr,
+                                      void  * blockPtr)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((poolPtr != NULL) && (blockPtr != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((poolPtr != NULL) && (blockPtr != NULL))
+  {
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+    /* Account for the release in the statistics. */
+    TbxMemPoolStatsReleased(poolPtr, 1U);
+#endif
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+    /* Release the block into the magazine of the calling thread. This way it can be
+     * allocated again in the future.
+     */
+    TbxMemPoolMagazineRelease(poolPtr, blockPtr);
+#else
+    /* Insert the block into the linked list with free blocks. This way it can be
+     * allocated again in the future.
+     */
+    TbxMemPoolBlockListInsert(poolPtr, blockPtr, blockPtr);
+#endif
+  }
+} /*** end of TbxMemPoolReleaseInternal ***/
+
+
+/****************************************************************************************
+*   P O O L   L I S T   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Locates the first memory pool node in the linked list with memory pools,
+**            that holds blocks with a size that is equal to or greater than the
+**            specified block size. The size class index provides the starting point, so
+**            only memory pools with a block size in the same size class need to be
+**            skipped. For block sizes beyond TBX_CONF_MEMPOOL_INDEX_SIZE_MAX, the search
+**            starts at the memory pools of the last size class.
+** \param     blockSize Size of the block to fit.
+** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListLookup(size_t blockSize)
+{
+  tPoolNode * result;
+  size_t      indexIdx = TBX_MEMPOOL_INDEX_COUNT - 1U;
+
+  /* Determine the size class of the block size, if the index covers it. */
+  if ( (blockSize > 0U) && (blockSize <= TBX_CONF_MEMPOOL_INDEX_SIZE_MAX) )
+  {
+    indexIdx = (blockSize - 1U) / TBX_MEMPOOL_INDEX_GRANULARITY;
+  }
+  /* Get the first node with a block size that fits the smallest size of the class. */
+  result = TbxMemPoolListLoad(&tbxPoolIndex[indexIdx]);
+  /* Skip the nodes with a block size that is still too small. */
+  while (result != NULL)
+  {
+    /* Does this memory pool hold blocks that would fit the specified block size? */
+    if (result->poolPtr->blockSize >= blockSize)
+    {
+      /* Fit found, so no need to continue searching. */
+      break;
+    }
+    /* Continue with the next pool node in the list. */
+    result = TbxMemPoolListLoad(&result->nextNodePtr);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListLookup ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a pointer to a memory pool node from the linked list with memory
+**            pools or from its size class index. On ports with atomics, this is an
+**            acquire load that pairs with the release store of TbxMemPoolListStore(),
+**            such that the node is fully initialized once its pointer is seen. On other
+**            ports, the pointer is read in the critical section, in which the nodes are
+**            linked in.
+** \param     nodePtrPtr Pointer to the node pointer to read.
+** \return    The node pointer.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListLoad(tPoolNode * volatile const * nodePtrPtr)
+{
+  tPoolNode * result;
+
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  /* Read the node pointer with acquire semantics. */
+  result = TbxPortAtomicLoadPtr((void * volatile const *)nodePtrPtr);
+#else
+  /* Read the node pointer in the critical section. */
+  TbxCriticalSectionEnter();
+  result = *nodePtrPtr;
+  TbxCriticalSectionExit();
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListLoad ***/
+
+
+/************************************************************************************//**
+** \brief     Writes a pointer to a memory pool node into the linked list with memory
+**            pools or into its size class index. This publishes the node to the threads
+**            that search the list, so the node must be fully initialized beforehand. On
+**            ports with atomics, this is a release store that pairs with the acquire
+**            load of TbxMemPoolListLoad(). Should be called from within the critical
+**            section.
+** \param     nodePtrPtr Pointer to the node pointer to write.
+** \param     nodePtr The new value of the node pointer.
+**
+****************************************************************************************/
+static void TbxMemPoolListStore(tPoolNode * volatile * nodePtrPtr,
+                                tPoolNode            * nodePtr)
+{
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  /* Write the node pointer with release semantics. */
+  TbxPortAtomicStorePtr((void * volatile *)nodePtrPtr, nodePtr);
+#else
+  /* The critical section already orders the write with the reads. */
+  *nodePtrPtr = nodePtr;
+#endif
+} /*** end of TbxMemPoolListStore ***/
+
+
+/************************************************************************************//**
+** \brief     Searches the linked list with memory pools to find a pool that was
+**            created to hold blocks that are of the exact size as specified by the
+**            parameter.
+** \param     blockSize Size of the blocks managed by the memory pool.
+** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListFind(size_t blockSize)
+{
+  tPoolNode * result = NULL;
+  tPoolNode * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (blockSize > 0U)
+  {
+    /* Locate the first node with a block size that is large enough. */
+    poolNodePtr = TbxMemPoolListLookup(blockSize);
+    /* Does this node hold a memory pool created for the same block size as we are
+     * trying to find?
+     */
+    if (poolNodePtr != NULL)
+    {
+      if (poolNodePtr->poolPtr->blockSize == blockSize)
+      {
+        /* Update the result because a match was found. */
+        result = poolNodePtr;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListFind ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts the specified memory pool node into the linked list with memory
+**            pool nodes. It automatically sorts the nodes by ascending block size and
+**            updates the size class index accordingly. Note
+**            that this function only works properly is there is not already a memory
+**            pool in the list configured for the same block size as the new one that
+**            this function should insert.
+** \param     nodePtr Pointer to the memory pool node to insert.
+**
+****************************************************************************************/
+static void TbxMemPoolListInsert(tPoolNode * nodePtr)
+{
+  tPoolNode * currentNodePtr;
+  tPoolNode * prevNodePtr = NULL;
+  uint8_t     nodeInserted = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(nodePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (nodePtr != NULL)
+  {
+    /* Sanity check. The pointer to the memory pool should not be NULL here. */
+    TBX_ASSERT(nodePtr->poolPtr != NULL);
+    /* Is the list with memory pools empty? */
+    if (tbxPoolList == NULL)
+    {
+      /* Add the node at the start of the list. */
+      nodePtr->nextNodePtr = NULL;
+      TbxMemPoolListStore(&tbxPoolList, nodePtr);
+    }
+    /* The list with memory pools is not empty. */
+    else
+    {
+      /* Get pointer to the pool node at the head of the linked list. */
+      currentNodePtr = tbxPoolList;
+      /* Loop through the nodes to find the location where the new node should be
+       * inserted, such that the nodes always remain sorted by ascending block size.
+       */
+      while (currentNodePtr != NULL)
+      {
+        /* Sanity check. The pointer to the memory pool should not be NULL here. */
+        TBX_ASSERT(currentNodePtr->poolPtr != NULL);
+        /* Only continue if the sanity check passed. */
+        if (currentNodePtr->poolPtr != NULL)
+        {
+          /* This function should not be used to insert a memory pool node that has a
+           * block size that equals an already existing node. Verify this.
+          */
+          TBX_ASSERT(currentNodePtr->poolPtr->blockSize != nodePtr->poolPtr->blockSize);
+          /* Is the block size of this node's memory pool larger than the new one? */
+          if (currentNodePtr->poolPtr->blockSize > nodePtr->poolPtr->blockSize)
+          {
+            /* The new node should be inserted before this one. If the current node is
+             * the head of the list, the new node should become the new head.
+            */
+            if (currentNodePtr == tbxPoolList)
+            {
+              /* Sanity check. In this case the previous node should still be NULL. */
+              TBX_ASSERT(prevNodePtr == NULL);
+              /* Add the node at the start of the list, right before the current node. */
+              nodePtr->nextNodePtr = currentNodePtr;
+              TbxMemPoolListStore(&tbxPoolList, nodePtr);
+            }
+            /* The current node is not the head of the list, so the new node should be
+             * inserted between previous node and the current node.
+            */
+            else
+            {
+              /* Sanity check. In this case the previous node should not be NULL. */
+              TBX_ASSERT(prevNodePtr != NULL);
+              /* Only continue if the sanity check passed. */
+              if (prevNodePtr != NULL)
+              {
+                /* Insert the node between the previous and current nodes. */
+                nodePtr->nextNodePtr = currentNodePtr;
+                TbxMemPoolListStore(&prevNodePtr->nextNodePtr, nodePtr);
+              }
+            }
+            /* Set flag to indicate that the new node was successfully inserted. */
+            nodeInserted = TBX_TRUE;
+          }
+        }
+        /* Did we reach the end of the list and the new node was not yet inserted? */
+        if ( (currentNodePtr->nextNodePtr == NULL) && (nodeInserted == TBX_FALSE) )
+        {
+          /* There are no memory pools present in the list that have a block size larger
+           * than the new node. This means that the new node should be inserted at the
+           * tail of the list.
+           */
+          nodePtr->nextNodePtr = NULL;
+          TbxMemPoolListStore(&currentNodePtr->nextNodePtr, nodePtr);
+          /* Set flag to indicate that the new node was successfully inserted. */
+          nodeInserted = TBX_TRUE;
+        }
+        /* Check if the new node was already inserted. */
+        if (nodeInserted == TBX_TRUE)
+        {
+          /* All done so no need to continue looping. */
+          break;
+        }
+        /* Update loop variables. */
+        prevNodePtr = currentNodePtr;
+        currentNodePtr = currentNodePtr->nextNodePtr;
+      }
+    }
+    /* Update the size class index. The new node becomes the entry of each size class
+     * that it fits, in case it is smaller than the current entry.
+     */
+    for (size_t indexIdx = 0U; indexIdx < TBX_MEMPOOL_INDEX_COUNT; indexIdx++)
+    {
+      /* Does the new node hold blocks that fit the smallest size of the class? */
+      if (nodePtr->poolPtr->blockSize > (indexIdx * TBX_MEMPOOL_INDEX_GRANULARITY))
+      {
+        /* Is it smaller than the current entry? */
+        if ( (tbxPoolIndex[indexIdx] == NULL) ||
+             (tbxPoolIndex[indexIdx]->poolPtr->blockSize > nodePtr->poolPtr->blockSize) )
+        {
+          /* Make the new node the entry of this size class. */
+          TbxMemPoolListStore(&tbxPoolIndex[indexIdx], nodePtr);
+        }
+      }
+    }
+  }
+} /*** end of TbxMemPoolListInsert ***/
+
+
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Checks if the specified memory pool is present in the linked list with
+**            memory pools. Note that only the pointer value is compared. The memory that
+**            it points to is not accessed, so it is safe to call this function with an
+**            invalid pointer.
+** \param     poolPtr Pointer to the memory pool.
+** \return    TBX_TRUE if the memory pool is in the list, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxMemPoolListContains(tPool const * poolPtr)
+{
+  uint8_t           result = TBX_FALSE;
+  tPoolNode const * poolNodePtr = TbxMemPoolListLoad(&tbxPoolList);
+
+  /* Loop through all nodes in the list. */
+  while (poolNodePtr != NULL)
+  {
+    /* Does this node hold the memory pool? */
+    if (poolNodePtr->poolPtr == poolPtr)
+    {
+      /* Update the result because a match was found and stop searching. */
+      result = TBX_TRUE;
+      break;
+    }
+    /* Continue with the next pool node in the list. */
+    poolNodePtr = TbxMemPoolListLoad(&poolNodePtr->nextNodePtr);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListContains ***/
+#endif /* (TBX_CONF_ASSERTIONS_ENABLE > 0U) */
+
+
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED == 0U)
+/****************************************************************************************
+*   P O O L   L O C K I N G   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Initializes the lock of the memory pool. On ports that offer locks, each
+**            memory pool has a lock of its own. This way threads that allocate from
+**            different memory pools do not block each other.
+** \param     poolPtr Pointer to the memory pool.
+**
+****************************************************************************************/
+static void TbxMemPoolLockInit(tPool * poolPtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_PORT_LOCKS_SUPPORTED > 0U)
+    /* Initialize the port specific lock. */
+    TbxPortLockInit(&poolPtr->lock);
+#endif
+  }
+} /*** end of TbxMemPoolLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the linked list with free blocks of the
+**            memory pool. Falls back to the critical section on ports that do not offer
+**            locks.
+** \param     poolPtr Pointer to the memory pool.
+**
+****************************************************************************************/
+static void TbxMemPoolLockAcquire(tPool * poolPtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_PORT_LOCKS_SUPPORTED > 0U)
+    /* Acquire the lock of this memory pool. */
+    TbxPortLockAcquire(&poolPtr->lock);
+#else
+    /* Enter the critical section. */
+    TbxCriticalSectionEnter();
+#endif
+  }
+} /*** end of TbxMemPoolLockAcquire ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the linked list with free blocks of the
+**            memory pool, which was obtained with TbxMemPoolLockAcquire().
+** \param     poolPtr Pointer to the memory pool.
+**
+****************************************************************************************/
+static void TbxMemPoolLockRelease(tPool * poolPtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_PORT_LOCKS_SUPPORTED > 0U)
+    /* Release the lock of this memory pool. */
+    TbxPortLockRelease(&poolPtr->lock);
+#else
+    /* Exit the critical section. */
+    TbxCriticalSectionExit();
+#endif
+  }
+} /*** end of TbxMemPoolLockRelease ***/
+#endif /* (TBX_PORT_ATOMICS_TAGGED_SUPPORTED == 0U) */
+
+
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U)
+/****************************************************************************************
+*   M A G A Z I N E   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Obtains the magazine of the calling thread, in which it caches the free
+**            blocks of the memory pool. There is one magazine per size class of the
+**            size class index. Memory pools with a block size in the same size class
+**            share the magazine.
+** \param     poolPtr Pointer to the memory pool.
+** \return    Pointer to the magazine.
+**
+****************************************************************************************/
+static tMagazine * TbxMemPoolMagazineGet(tPool const * poolPtr)
+{
+  size_t indexIdx = TBX_MEMPOOL_INDEX_COUNT - 1U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Determine the size class of the block size, if the index covers it. */
+  if ( (poolPtr != NULL) && (poolPtr->blockSize <= TBX_CONF_MEMPOOL_INDEX_SIZE_MAX) )
+  {
+    indexIdx = (poolPtr->blockSize - 1U) / TBX_MEMPOOL_INDEX_GRANULARITY;
+  }
+  /* Give the result back to the caller. */
+  return &tbxPoolMagazines[indexIdx];
+} /*** end of TbxMemPoolMagazineGet ***/
+
+
+/************************************************************************************//**
+** \brief     Moves all blocks in the magazine back to the free block list of the memory
+**            pool that they belong to. This happens with just one update of the free
+**            block list. Afterwards, the magazine is empty and no longer belongs to a
+**            memory pool.
+** \param     magazinePtr Pointer to the magazine.
+**
+****************************************************************************************/
+static void TbxMemPoolMagazineEmpty(tMagazine * magazinePtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(magazinePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (magazinePtr != NULL)
+  {
+    /* Only give blocks back if the magazine holds blocks. */
+    if (magazinePtr->numBlocks > 0U)
+    {
+      /* Insert all its blocks into the free block list at once. They are already
+       * linked together.
+       */
+      TbxMemPoolBlockListInsert(magazinePtr->poolPtr, magazinePtr->firstBlockPtr,
+                                magazinePtr->lastBlockPtr);
+    }
+    /* Reset the magazine. */
+    magazinePtr->poolPtr = NULL;
+    magazinePtr->firstBlockPtr = NULL;
+    magazinePtr->lastBlockPtr = NULL;
+    magazinePtr->numBlocks = 0U;
+  }
+} /*** end of TbxMemPoolMagazineEmpty ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates a block of the memory pool, using the magazine of the calling
+**            thread. Only if the magazine is empty, is it refilled with a batch of
+**            blocks from the free block list of the memory pool.
+** \param     poolPtr Pointer to the memory pool.
+** \return    Pointer to the memory of the block if successful, NULL otherwise.
+**
+****************************************************************************************/
+static void * TbxMemPoolMagazineAllocate(tPool * poolPtr)
+{
+  void       * result = NULL;
+  void      ** nextBlockPtr;
+  tMagazine  * magazinePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+    /* Get the magazine of the calling thread for this memory pool's size class. */
+    magazinePtr = TbxMemPoolMagazineGet(poolPtr);
+    /* Does it hold blocks of another memory pool in the same size class? */
+    if (magazinePtr->poolPtr != poolPtr)
+    {
+      /* Give them back to their memory pool and use the magazine for this one. */
+      TbxMemPoolMagazineEmpty(magazinePtr);
+      magazinePtr->poolPtr = poolPtr;
+    }
+    /* Refill the magazine with a batch of blocks if it is empty. */
+    if (magazinePtr->numBlocks == 0U)
+    {
+      magazinePtr->numBlocks = TbxMemPoolBlockListExtractChain(poolPtr,
+                                                               TBX_MEMPOOL_MAGAZINE_BATCH,
+                                                               &magazinePtr->firstBlockPtr,
+                                                               &magazinePtr->lastBlockPtr);
+    }
+    /* Only continue if the magazine holds a block. */
+    if (magazinePtr->numBlocks > 0U)
+    {
+      /* Take the first block. */
+      result = magazinePtr->firstBlockPtr;
+      /* The pointer to the next block is stored at the start of the block's data. */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(result);
+      magazinePtr->firstBlockPtr = *nextBlockPtr;
+      magazinePtr->numBlocks--;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolMagazineAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a block of the memory pool into the magazine of the calling
+**            thread. Only if the magazine is full, are its blocks moved back to the free
+**            block list of the memory pool, all at once.
+** \param     poolPtr Pointer to the memory pool.
+** \param     blockPtr Pointer to the memory of the block.
+**
+****************************************************************************************/
+static void TbxMemPoolMagazineRelease(tPool * poolPtr,
+                                      void  * blockPtr)
+{
+  void      ** nextBlockPtr;
+  tMagazine  * magazinePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(blockPtr != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (blockPtr != NULL) )
+  {
+    /* Get the magazine of the calling thread for this memory pool's size class. */
+    magazinePtr = TbxMemPoolMagazineGet(poolPtr);
+    /* Give its blocks back to the memory pool if it is full or if it holds blocks of
+     * another memory pool in the same size class.
+     */
+    if ( (magazinePtr->poolPtr != poolPtr) ||
+         (magazinePtr->numBlocks >= TBX_CONF_MEMPOOL_MAGAZINE_SIZE) )
+    {
+      TbxMemPoolMagazineEmpty(magazinePtr);
+      magazinePtr->poolPtr = poolPtr;
+    }
+    /* The pointer to the next block is stored at the start of the block's data. Add the
+     * block at the start of the magazine.
+     */
+    nextBlockPtr = TbxMemPoolBlockGetDataPtr(blockPtr);
+    *nextBlockPtr = magazinePtr->firstBlockPtr;
+    magazinePtr->firstBlockPtr = blockPtr;
+    /* The first block added to an empty magazine is also its last block. */
+    if (magazinePtr->numBlocks == 0U)
+    {
+      magazinePtr->lastBlockPtr = blockPtr;
+    }
+    magazinePtr->numBlocks++;
+  }
+} /*** end of TbxMemPoolMagazineRelease ***/
+#endif /* (TBX_CONF_MEMPOOL_MAGAZINE_SIZE > 0U) */
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/****************************************************************************************
+*   S T A T I S T I C S   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Updates the statistics of the memory pool after an allocation attempt. The
+**            allocated blocks are added to the number of used blocks, which raises its
+**            peak, if needed. The allocation counts as failed, if fewer blocks were
+**            allocated than requested. On ports with support for atomic operations, this
+**            is lock-free.
+** \param     poolPtr Pointer to the memory pool.
+** \param     numBlocks Number of blocks that were allocated.
+** \param     numRequested Number of blocks that were requested.
+**
+****************************************************************************************/
+static void TbxMemPoolStatsAllocated(tPool  * poolPtr,
+                                     size_t   numBlocks,
+                                     size_t   numRequested)
+{
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  size_t counter;
+  size_t peak;
+#endif
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    /* Only update the used blocks, if blocks were allocated. */
+    if (numBlocks > 0U)
+    {
+      /* Keep trying to add the blocks to the counter, until no other thread changed it
+       * in the meantime.
+       */
+      do
+      {
+        counter = TbxPortAtomicLoad(&poolPtr->usedBlocks);
+      }
+      while (TbxPortAtomicCompareExchange(&poolPtr->usedBlocks, counter,
+                                          counter + numBlocks) == TBX_FALSE);
+      counter += numBlocks;
+      /* Raise the peak of the used blocks, if the number of used blocks exceeds it. */
+      do
+      {
+        peak = TbxPortAtomicLoad(&poolPtr->peakUsedBlocks);
+        /* All done if another thread already raised it far enough. */
+        if (peak >= counter)
+        {
+          break;
+        }
+      }
+      while (TbxPortAtomicCompareExchange(&poolPtr->peakUsedBlocks, peak,
+                                          counter) == TBX_FALSE);
+    }
+    /* Count the failed allocation, if not all requested blocks were allocated. */
+    if (numBlocks < numRequested)
+    {
+      do
+      {
+        counter = TbxPortAtomicLoad(&poolPtr->failedAllocs);
+      }
+      while (TbxPortAtomicCompareExchange(&poolPtr->failedAllocs, counter,
+                                          counter + 1U) == TBX_FALSE);
+    }
+#else
+    /* Obtain mutual exclusive access to the statistics. */
+    TbxCriticalSectionEnter();
+    /* Add the allocated blocks to the used blocks. */
+    poolPtr->usedBlocks += numBlocks;
+    /* Raise the peak of the used blocks, if the number of used blocks exceeds it. */
+    if (poolPtr->usedBlocks > poolPtr->peakUsedBlocks)
+    {
+      poolPtr->peakUsedBlocks = poolPtr->usedBlocks;
+    }
+    /* Count the failed allocation, if not all requested blocks were allocated. */
+    if (numBlocks < numRequested)
+    {
+      poolPtr->failedAllocs++;
+    }
+    /* Release mutual exclusive access to the statistics. */
+    TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+  }
+} /*** end of TbxMemPoolStatsAllocated ***/
+
+
+/************************************************************************************//**
+** \brief     Updates the statistics of the memory pool after the release of blocks, by
+**            subtracting them from the number of used blocks. On ports with support for
+**            atomic operations, this is lock-free.
+** \param     poolPtr Pointer to the memory pool.
+** \param     numBlocks Number of blocks that were released.
+**
+****************************************************************************************/
+static void TbxMemPoolStatsReleased(tPool  * poolPtr,
+                                    size_t   numBlocks)
+{
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+  size_t counter;
+#endif
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    /* Keep trying to subtract the blocks from the counter, until no other thread changed
+     * it in the meantime.
+     */
+    do
+    {
+      counter = TbxPortAtomicLoad(&poolPtr->usedBlocks);
+      /* Sanity check. The released blocks should all have been in use. */
+      if (counter < numBlocks)
+      {
+        TBX_ASSERT(counter >= numBlocks);
+        break;
+      }
+    }
+    while (TbxPortAtomicCompareExchange(&poolPtr->usedBlocks, counter,
+                                        counter - numBlocks) == TBX_FALSE);
+#else
+    /* Obtain mutual exclusive access to the statistics. */
+    TbxCriticalSectionEnter();
+    /* Sanity check. The released blocks should all have been in use. */
+    TBX_ASSERT(poolPtr->usedBlocks >= numBlocks);
+    /* Subtract the blocks from the counter, if the sanity check passed. */
+    if (poolPtr->usedBlocks >= numBlocks)
+    {
+      poolPtr->usedBlocks -= numBlocks;
+    }
+    /* Release mutual exclusive access to the statistics. */
+    TbxCriticalSectionExit();
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+  }
+} /*** end of TbxMemPoolStatsReleased ***/
+
+
+/************************************************************************************//**
+** \brief     Reads out the statistics of the memory pool.
+** \param     poolPtr Pointer to the memory pool.
+** \param     stats Pointer to where the statistics are written to.
+**
+****************************************************************************************/
+static void TbxMemPoolStatsRead(tPool      const * poolPtr,
+                                tTbxMemPoolStats * stats)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (stats != NULL) )
+  {
+    /* The block size never changes, so it can be read directly. */
+    stats->blockSize = poolPtr->blockSize;
+    /* Obtain mutual exclusive access to the number of blocks. */
+    TbxCriticalSectionEnter();
+    stats->numBlocks = poolPtr->numBlocks;
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+    /* The counters are updated lock-free, so read them atomically. */
+    stats->usedBlocks = TbxPortAtomicLoad(&poolPtr->usedBlocks);
+    stats->peakUsedBlocks = TbxPortAtomicLoad(&poolPtr->peakUsedBlocks);
+    stats->failedAllocs = TbxPortAtomicLoad(&poolPtr->failedAllocs);
+#else
+    /* The counters are updated in the critical section, so read them directly. */
+    stats->usedBlocks = poolPtr->usedBlocks;
+    stats->peakUsedBlocks = poolPtr->peakUsedBlocks;
+    stats->failedAllocs = poolPtr->failedAllocs;
+#endif
+    /* Release mutual exclusive access to the number of blocks. */
+    TbxCriticalSectionExit();
+    /* All blocks that are not in use, are free. */
+    stats->freeBlocks = (stats->numBlocks > stats->usedBlocks) ?
+                        (stats->numBlocks - stats->usedBlocks) : 0U;
+  }
+} /*** end of TbxMemPoolStatsRead ***/
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
+
+
+/****************************************************************************************
+*   S L A B   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Allocates the memory for a new slab. The memory of the slabs that were
+**            released by TbxMemPoolShrink() is reused first. The new slab is taken from
+**            the start of the first released slab that is large enough, such that the
+**            remaining memory can stay a released slab. If its start is not aligned, the
+**            new slab is taken from its end instead, enlarged with the bytes that are left
+**            over after it because of the alignment. The new slab is enlarged with the
+**            remaining memory, if that is too small to ever hold a slab. Only if no
+**            released slab is large enough, is the memory taken from the heap.
+** \param     sizePtr Pointer to the number of bytes to allocate for the slab. Updated
+**            with the actual number of bytes of the slab.
+** \param     alignment Desired alignment of the start address in bytes. A power of two
+**            that is at least the address size.
+** \return    Pointer to the start of the slab's memory if successful, NULL otherwise.
+**
+****************************************************************************************/
+static uint8_t * TbxMemPoolSlabAllocate(size_t * sizePtr,
+                                        size_t   alignment)
+{
+  uint8_t   * result = NULL;
+  uintptr_t   slabStart;
+  uintptr_t   slabEnd;
+  uintptr_t   allocStart;
+  size_t      size;
+  size_t      sizeMin;
+  tSlab     * slabPtr;
+  tSlab     * prevSlabPtr = NULL;
+  tSlab     * nextSlabPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(sizePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (sizePtr != NULL)
+  {
+    size = *sizePtr;
+    /* Determine the size of the smallest possible slab, with just one small block. */
+    sizeMin = TbxMemPoolSlabGetOffset(sizeof(void *)) +
+              TbxMemPoolBlockGetStride(1U, sizeof(void *));
+    /* Obtain mutual exclusive access to the released slabs. */
+    TbxCriticalSectionEnter();
+    /* Loop through the released slabs to find the first one that is large enough. */
+    slabPtr = tbxPoolFreeSlabList;
+    while (slabPtr != NULL)
     {
-      /* Does this node hold a memory pool created for the same block size as we are
-       * trying to find?
-       */
-      if (poolNodePtr->poolPtr->blockSize == blockSize)
+      /* Only continue if it is not too small, even without considering the alignment. */
+      if (slabPtr->size >= size)
       {
-        /* Update the result because a match was found. */
-        result = poolNodePtr;
-        /* No need to continue looping since a match was found. */
-        break;
+        slabStart = (uintptr_t)slabPtr;
+        slabEnd = slabStart + slabPtr->size;
+        nextSlabPtr = slabPtr->nextSlabPtr;
+        /* Is its start aligned? */
+        if ((slabStart & ((uintptr_t)alignment - 1U)) == 0U)
+        {
+          /* Is the remaining memory large enough to hold a slab? */
+          if ((slabPtr->size - size) >= sizeMin)
+          {
+            /* Keep the remaining memory as a released slab, right after the new one. */
+            nextSlabPtr = (tSlab *)(void *)&((uint8_t *)(void *)slabPtr)[size];
+            nextSlabPtr->size = slabPtr->size - size;
+            nextSlabPtr->nextSlabPtr = slabPtr->nextSlabPtr;
+          }
+          else
+          {
+            /* Enlarge the new slab with the remaining memory. */
+            size = slabPtr->size;
+          }
+          /* Replace the released slab in the list. */
+          if (prevSlabPtr == NULL)
+          {
+            tbxPoolFreeSlabList = nextSlabPtr;
+          }
+          else
+          {
+            prevSlabPtr->nextSlabPtr = nextSlabPtr;
+          }
+          /* Set the result value and stop searching. */
+          result = (uint8_t *)(void *)slabPtr;
+          break;
+        }
+        /* Determine the aligned start address, when taking the memory from its end. */
+        allocStart = (slabEnd - size) & ~((uintptr_t)alignment - 1U);
+        /* Does it still fit after the alignment, while leaving room for the header of
+         * the remaining memory?
+         */
+        if ( (allocStart >= slabStart) && ((allocStart - slabStart) >= sizeMin) )
+        {
+          /* Keep the remaining memory as a released slab. */
+          slabPtr->size = (size_t)(allocStart - slabStart);
+          /* Enlarge the new slab with the bytes after it, which are left over because of
+           * the alignment. Otherwise they would be lost.
+           */
+          size = (size_t)(slabEnd - allocStart);
+          /* Set the result value and stop searching. */
+          result = (uint8_t *)allocStart;
+          break;
+        }
       }
-      /* Continue with the next pool node in the list. */
-      poolNodePtr = poolNodePtr->nextNodePtr;
+      /* Continue with the next released slab. */
+      prevSlabPtr = slabPtr;
+      slabPtr = slabPtr->nextSlabPtr;
     }
+    /* Release mutual exclusive access to the released slabs. */
+    TbxCriticalSectionExit();
+
+    /* Take the memory from the heap, if no released slab was large enough. */
+    if (result == NULL)
+    {
+      result = TbxHeapAllocateAligned(size, alignment);
+    }
+    /* Update the actual size of the slab. */
+    *sizePtr = size;
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolListFind ***/
+} /*** end of TbxMemPoolSlabAllocate ***/
 
 
 /************************************************************************************//**
-** \brief     Searches through the linked list with memory pools to find a pool that was
-**            created to hold blocks that are of equal size or slightly greater. If the
-**            found memory pool has no more free blocks available the search
-**            is NOT continued for a memory pool of the next size up. Although this
-**            sounds like a nice feature to have, this was not implemented on purpose.
-**            The reason for this is that it is now possible to expand an existing memory
-**            pool when it is full. Assume a situation where all blocks in the memory
-**            pool are already allocated. The next call to TbxMemPoolAllocate() therefore
-**            fails. You can now call TbxMemPoolCreate() again for the same block size
-**            and the original memory pool is expanded automatically. Note that this
-**            function relies on the fact that the memory pools in the list are sorted
-**            by ascending block size.
-** \param     blockSize Size of the block to fit.
-** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+** \brief     Adds the slab to the released slabs, such that its memory can be reused.
+**            Released slabs that are adjacent in memory are merged into one, such that
+**            larger slabs can be allocated from them. Should be called from within the
+**            critical section.
+** \param     slabPtr Pointer to the slab.
 **
 ****************************************************************************************/
-static tPoolNode * TbxMemPoolListFindBestFit(size_t blockSize)
+static void TbxMemPoolSlabRelease(tSlab * slabPtr)
 {
-  tPoolNode * result = NULL;
-  tPoolNode * poolNodePtr;
+  tSlab   * freeSlabPtr;
+  tSlab   * prevSlabPtr;
+  uint8_t   merged;
 
   /* Verify parameter. */
-  TBX_ASSERT(blockSize > 0U);
+  TBX_ASSERT(slabPtr != NULL);
 
   /* Only continue if the parameter is valid. */
-  if (blockSize > 0U)
+  if (slabPtr != NULL)
   {
-    /* Get pointer to the pool node at the head of the linked list. */
-    poolNodePtr = tbxPoolList;
-    /* Loop through all nodes until a fit is found. */
-    while (poolNodePtr != NULL)
+    /* Keep merging until no more adjacent released slabs are found. */
+    do
     {
-      /* Does this memory pool hold blocks that would fit the specified block size? */
-      if (poolNodePtr->poolPtr->blockSize >= blockSize)
+      merged = TBX_FALSE;
+      prevSlabPtr = NULL;
+      freeSlabPtr = tbxPoolFreeSlabList;
+      /* Loop through the released slabs to find an adjacent one. */
+      while (freeSlabPtr != NULL)
       {
-        /* A fit is found. Now check if this memory pool has free blocks available. */
-        if (TbxMemPoolBlockListIsEmpty(poolNodePtr->poolPtr->freeBlockListPtr) \
-            == TBX_FALSE)
+        /* Is it located right before or right after the slab? */
+        if ( (((uintptr_t)freeSlabPtr + freeSlabPtr->size) == (uintptr_t)slabPtr) ||
+             (((uintptr_t)slabPtr + slabPtr->size) == (uintptr_t)freeSlabPtr) )
         {
-          /* Found a match so update the result value. */
-          result = poolNodePtr;
+          /* Take it out of the list. */
+          if (prevSlabPtr == NULL)
+          {
+            tbxPoolFreeSlabList = freeSlabPtr->nextSlabPtr;
+          }
+          else
+          {
+            prevSlabPtr->nextSlabPtr = freeSlabPtr->nextSlabPtr;
+          }
+          /* Merge the two, keeping the header of the one with the lowest address. */
+          if ((uintptr_t)freeSlabPtr < (uintptr_t)slabPtr)
+          {
+            freeSlabPtr->size += slabPtr->size;
+            slabPtr = freeSlabPtr;
+          }
+          else
+          {
+            slabPtr->size += freeSlabPtr->size;
+          }
+          /* Start over, because the merged slab could be adjacent to another one. */
+          merged = TBX_TRUE;
+          break;
         }
-        /* Best fit is found, so no need to continue searching even if the memory pool
-         * does not have any free blocks available.
-         */
-        break;
+        /* Continue with the next released slab. */
+        prevSlabPtr = freeSlabPtr;
+        freeSlabPtr = freeSlabPtr->nextSlabPtr;
       }
-      /* Continue with the next pool node in the list. */
-      poolNodePtr = poolNodePtr->nextNodePtr;
     }
+    while (merged == TBX_TRUE);
+    /* Add the slab at the start of the list. */
+    slabPtr->nextSlabPtr = tbxPoolFreeSlabList;
+    tbxPoolFreeSlabList = slabPtr;
   }
+} /*** end of TbxMemPoolSlabRelease ***/
 
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of TbxMemPoolListFindBestFit ***/
+
+/************************************************************************************//**
+** \brief     Determines the number of bytes from the start of a slab, up to the start of
+**            its first block. This leaves room for the slab header, followed by a few
+**            unused bytes, such that the data after the memory pool pointer of the first
+**            block is aligned.
+** \param     alignment Alignment of the block data in bytes. A power of two that is at
+**            least the address size.
+** \return    Offset of the first block in the slab in bytes.
+**
+****************************************************************************************/
+static size_t TbxMemPoolSlabGetOffset(size_t alignment)
+{
+  /* Round the header and the memory pool pointer up to the alignment and step back to
+   * the memory pool pointer.
+   */
+  return ((sizeof(tSlab) + sizeof(tPool *) + (alignment - 1U)) & ~(alignment - 1U)) -
+         sizeof(tPool *);
+} /*** end of TbxMemPoolSlabGetOffset ***/
 
 
 /************************************************************************************//**
-** \brief     Inserts the specified memory pool node into the linked list with memory
-**            pool nodes. It automatically sorts the nodes by ascending block size. Note
-**            that this function only works properly is there is not already a memory
-**            pool in the list configured for the same block size as the new one that
-**            this function should insert.
-** \param     nodePtr Pointer to the memory pool node to insert.
+** \brief     Counts how many blocks of a chain with linked blocks are located in the
+**            memory of the specified slab.
+** \param     slabPtr Pointer to the slab.
+** \param     firstBlockPtr Pointer to the memory of the first block of the chain.
+** \param     numBlocks Number of blocks in the chain.
+** \return    The number of blocks of the chain that are located in the slab.
 **
 ****************************************************************************************/
-static void TbxMemPoolListInsert(tPoolNode * nodePtr)
+static size_t TbxMemPoolSlabCountBlocks(tSlab const * slabPtr,
+                                        void        * firstBlockPtr,
+                                        size_t        numBlocks)
 {
-  tPoolNode * currentNodePtr;
-  tPoolNode * prevNodePtr = NULL;
-  uint8_t     nodeInserted = TBX_FALSE;
+  size_t      result = 0U;
+  size_t      blockIdx;
+  void      * blockPtr = firstBlockPtr;
+  void     ** nextBlockPtr;
+  uintptr_t   slabStart;
+  uintptr_t   slabEnd;
 
   /* Verify parameter. */
-  TBX_ASSERT(nodePtr != NULL);
+  TBX_ASSERT(slabPtr != NULL);
 
   /* Only continue if the parameter is valid. */
-  if (nodePtr != NULL)
+  if (slabPtr != NULL)
   {
-    /* Sanity check. The pointer to the memory pool should not be NULL here. */
-    TBX_ASSERT(nodePtr->poolPtr != NULL);
-    /* Is the list with memory pools empty? */
-    if (tbxPoolList == NULL)
+    /* Determine the memory range of the slab. */
+    slabStart = (uintptr_t)slabPtr;
+    slabEnd = slabStart + slabPtr->size;
+    /* Loop through the blocks of the chain. */
+    for (blockIdx = 0U; blockIdx < numBlocks; blockIdx++)
     {
-      /* Add the node at the start of the list. */
-      nodePtr->nextNodePtr = NULL;
-      tbxPoolList = nodePtr;
+      /* Count the block if it is located in the slab. */
+      if ( ((uintptr_t)blockPtr >= slabStart) && ((uintptr_t)blockPtr < slabEnd) )
+      {
+        result++;
+      }
+      /* The pointer to the next block is stored at the start of the block's data. */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(blockPtr);
+      blockPtr = *nextBlockPtr;
     }
-    /* The list with memory pools is not empty. */
-    else
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolSlabCountBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the blocks that are located in the memory of the specified slab,
+**            from a chain with linked blocks. The remaining blocks stay linked together
+**            in the same order.
+** \param     slabPtr Pointer to the slab.
+** \param     firstBlockPtr Pointer to the pointer to the memory of the first block of the
+**            chain. Updated if the first block is removed.
+** \param     lastBlockPtr Pointer to the pointer to the memory of the last block of the
+**            chain. Updated if the last block is removed.
+** \param     numBlocks Number of blocks in the chain.
+** \return    The number of blocks that remain in the chain.
+**
+****************************************************************************************/
+static size_t TbxMemPoolSlabRemoveBlocks(tSlab const  * slabPtr,
+                                         void        ** firstBlockPtr,
+                                         void        ** lastBlockPtr,
+                                         size_t         numBlocks)
+{
+  size_t      result = 0U;
+  size_t      blockIdx;
+  void      * blockPtr;
+  void      * nextChainBlockPtr;
+  void     ** nextBlockPtr;
+  uintptr_t   slabStart;
+  uintptr_t   slabEnd;
+
+  /* Verify parameters. */
+  TBX_ASSERT(slabPtr != NULL);
+  TBX_ASSERT(firstBlockPtr != NULL);
+  TBX_ASSERT(lastBlockPtr != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (slabPtr != NULL) && (firstBlockPtr != NULL) && (lastBlockPtr != NULL) )
+  {
+    /* Determine the memory range of the slab. */
+    slabStart = (uintptr_t)slabPtr;
+    slabEnd = slabStart + slabPtr->size;
+    /* Rebuild the chain with just the blocks that are located outside of the slab. */
+    blockPtr = *firstBlockPtr;
+    *firstBlockPtr = NULL;
+    *lastBlockPtr = NULL;
+    for (blockIdx = 0U; blockIdx < numBlocks; blockIdx++)
     {
-      /* Get pointer to the pool node at the head of the linked list. */
-      currentNodePtr = tbxPoolList;
-      /* Loop through the nodes to find the location where the new node should be
-       * inserted, such that the nodes always remain sorted by ascending block size.
+      /* The pointer to the next block is stored at the start of the block's data. Read
+       * it before the block is linked to another block.
        */
-      while (currentNodePtr != NULL)
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(blockPtr);
+      nextChainBlockPtr = *nextBlockPtr;
+      /* Keep the block if it is located outside of the slab. */
+      if ( ((uintptr_t)blockPtr < slabStart) || ((uintptr_t)blockPtr >= slabEnd) )
       {
-        /* Sanity check. The pointer to the memory pool should not be NULL here. */
-        TBX_ASSERT(currentNodePtr->poolPtr != NULL);
-        /* Only continue if the sanity check passed. */
-        if (currentNodePtr->poolPtr != NULL)
-        {
-          /* This function should not be used to insert a memory pool node that has a
-           * block size that equals an already existing node. Verify this.
-          */
-          TBX_ASSERT(currentNodePtr->poolPtr->blockSize != nodePtr->poolPtr->blockSize);
-          /* Is the block size of this node's memory pool larger than the new one? */
-          if (currentNodePtr->poolPtr->blockSize > nodePtr->poolPtr->blockSize)
-          {
-            /* The new node should be inserted before this one. If the current node is
-             * the head of the list, the new node should become the new head.
-            */
-            if (currentNodePtr == tbxPoolList)
-            {
-              /* Sanity check. In this case the previous node should still be NULL. */
-              TBX_ASSERT(prevNodePtr == NULL);
-              /* Add the node at the start of the list, right before the current node. */
-              nodePtr->nextNodePtr = currentNodePtr;
-              tbxPoolList = nodePtr;
-            }
-            /* The current node is not the head of the list, so the new node should be
-             * inserted between previous node and the current node.
-            */
-            else
-            {
-              /* Sanity check. In this case the previous node should not be NULL. */
-              TBX_ASSERT(prevNodePtr != NULL);
-              /* Only continue if the sanity check passed. */
-              if (prevNodePtr != NULL)
-              {
-                /* Insert the node between the previous and current nodes. */
-                nodePtr->nextNodePtr = currentNodePtr;
-                prevNodePtr->nextNodePtr = nodePtr;
-              }
-            }
-            /* Set flag to indicate that the new node was successfully inserted. */
-            nodeInserted = TBX_TRUE;
-          }
-        }
-        /* Did we reach the end of the list and the new node was not yet inserted? */
-        if ( (currentNodePtr->nextNodePtr == NULL) && (nodeInserted == TBX_FALSE) )
+        /* Add the block at the end of the rebuilt chain. */
+        if (*lastBlockPtr == NULL)
         {
-          /* There are no memory pools present in the list that have a block size larger
-           * than the new node. This means that the new node should be inserted at the
-           * tail of the list.
-           */
-          nodePtr->nextNodePtr = NULL;
-          currentNodePtr->nextNodePtr = nodePtr;
-          /* Set flag to indicate that the new node was successfully inserted. */
-          nodeInserted = TBX_TRUE;
+          *firstBlockPtr = blockPtr;
         }
-        /* Check if the new node was already inserted. */
-        if (nodeInserted == TBX_TRUE)
+        else
         {
-          /* All done so no need to continue looping. */
-          break;
+          nextBlockPtr = TbxMemPoolBlockGetDataPtr(*lastBlockPtr);
+          *nextBlockPtr = blockPtr;
         }
-        /* Update loop variables. */
-        prevNodePtr = currentNodePtr;
-        currentNodePtr = currentNodePtr->nextNodePtr;
+        *lastBlockPtr = blockPtr;
+        result++;
       }
+      /* Continue with the next block of the chain. */
+      blockPtr = nextChainBlockPtr;
     }
   }
-} /*** end of TbxMemPoolListInsert ***/
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolSlabRemoveBlocks ***/
 
 
 /****************************************************************************************
@@ -756,47 +2785,63 @@ static void TbxMemPoolListInsert(tPoolNode * nodePtr)
 ****************************************************************************************/
 
 /************************************************************************************//**
-** \brief     Creates and initializes a new block including its memory allocation on the
-**            heap. A block consists of the actual memory to hold the block data and is
-**            preceded by an element of size_t, where the size of the block is written
-**            to:
+** \brief     Determines the number of bytes that a block occupies in the slab of its
+**            memory pool. A block consists of the actual memory to hold the block data
+**            and is preceded by a pointer to the memory pool that the block belongs to.
+**            The data is at least large enough to hold a pointer, which links the block
+**            into the free block list while it is not allocated. The result is a
+**            multiple of the alignment, such that the data of each block in the slab is
+**            aligned, once the data of the first block is.
+** \param     size The data size of the block in bytes.
+** \param     alignment Alignment of the block data in bytes. A power of two that is at
+**            least the address size.
+** \return    Number of bytes between the start of successive blocks in the slab.
+**
+****************************************************************************************/
+static size_t TbxMemPoolBlockGetStride(size_t size,
+                                       size_t alignment)
+{
+  size_t dataSize = size;
+
+  /* Make sure the block data can hold the pointer to the next free block. */
+  if (dataSize < sizeof(void *))
+  {
+    dataSize = sizeof(void *);
+  }
+  /* Add the memory pool pointer at the start and round up to the alignment. */
+  return (sizeof(tPool *) + dataSize + (alignment - 1U)) & ~(alignment - 1U);
+} /*** end of TbxMemPoolBlockGetStride ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes a new block in the memory of the slab of its memory pool. The
+**            pointer to the memory pool that the block belongs to, is written to its
+**            start. This way the memory pool of a block can be found without a search:
 **            memPtr  -> -----------
-**                      | blockSize |
+**                      | poolPtr   |
 **            dataPtr ->|------------------------------------------------
 **                      | data byte 0 | data byte 1 | data byte 2 | etc. |
 **                       ------------------------------------------------
-** \param     size The data size of the block in bytes.
-** \return    Pointer to the memory of the created block if successful, NULL otherwise.
+** \param     memPtr Pointer to the memory of the block.
+** \param     poolPtr Pointer to the memory pool that the block belongs to.
 **
 ****************************************************************************************/
-static void * TbxMemPoolBlockCreate(size_t size)
+static void TbxMemPoolBlockInit(void  * memPtr,
+                                tPool * poolPtr)
 {
-  void   * result = NULL;
-  void   * blockMemPtr;
-
-  /* Verify parameter. */
-  TBX_ASSERT(size > 0U);
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(poolPtr != NULL);
 
-  /* Only continue if the parameter is valid. */
-  if (size > 0U)
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (poolPtr != NULL) )
   {
-    /* Allocate memory for the block data and an extra size_t value at the start. */
-    blockMemPtr = TbxHeapAllocate(sizeof(size_t) + size);
-    /* Only continue if the memory allocation was successful. */
-    if (blockMemPtr != NULL)
-    {
-      /* Set the result value. */
-      result = blockMemPtr;
-      /* Create a pointer to an array of size_t elements. */
-      size_t * blockSizeArray = blockMemPtr;
-      /* Write to the first element, which should hold the block size. */
-      blockSizeArray[0U] = size;
-    }
+    /* Create a pointer to an array of memory pool pointers. */
+    tPool ** blockHeaderArray = memPtr;
+    /* Write to the first element, which should hold the memory pool pointer. */
+    blockHeaderArray[0U] = poolPtr;
   }
-
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of TbxMemPoolBlockCreate ***/
+} /*** end of TbxMemPoolBlockInit ***/
 
 
 /************************************************************************************//**
@@ -808,9 +2853,9 @@ static void * TbxMemPoolBlockCreate(size_t size)
 ****************************************************************************************/
 static void * TbxMemPoolBlockGetDataPtr(void * memPtr)
 {
-  void   * result = NULL;
-  size_t * blockSizeArray;
-  void   * dataPtr;
+  void   *  result = NULL;
+  tPool  ** blockHeaderArray;
+  void   *  dataPtr;
 
   /* Verify parameter. */
   TBX_ASSERT(memPtr != NULL);
@@ -818,10 +2863,10 @@ static void * TbxMemPoolBlockGetDataPtr(void * memPtr)
   /* Only continue if the parameter is valid. */
   if (memPtr != NULL)
   {
-    /* Create a pointer to an array of size_t elements. */
-    blockSizeArray = memPtr;
-    /* The block data starts after the block size value. */
-    dataPtr = &blockSizeArray[1U];
+    /* Create a pointer to an array of memory pool pointers. */
+    blockHeaderArray = memPtr;
+    /* The block data starts after the memory pool pointer. */
+    dataPtr = &blockHeaderArray[1U];
     /* Set the result value. */
     result = dataPtr;
   }
@@ -832,16 +2877,16 @@ static void * TbxMemPoolBlockGetDataPtr(void * memPtr)
 
 
 /************************************************************************************//**
-** \brief     Extract the size of the block data, given the pointer to the block's
-**            allocated memory.
+** \brief     Extract the memory pool that the block belongs to, given the pointer to the
+**            block's allocated memory.
 ** \param     memPtr Pointer to the start of the block's allocated memory.
-** \return    Size in bytes of the block's data if successful, 0 otherwise.
+** \return    Pointer to the memory pool if successful, NULL otherwise.
 **
 ****************************************************************************************/
-static size_t TbxMemPoolBlockGetBlockSize(void const * memPtr)
+static tPool * TbxMemPoolBlockGetPool(void const * memPtr)
 {
-  size_t         result = 0U;
-  size_t const * blockSizeArray;
+  tPool         * result = NULL;
+  tPool * const * blockHeaderArray;
 
   /* Verify parameter. */
   TBX_ASSERT(memPtr != NULL);
@@ -849,17 +2894,17 @@ static size_t TbxMemPoolBlockGetBlockSize(void const * memPtr)
   /* Only continue if the parameter is valid. */
   if (memPtr != NULL)
   {
-    /* Create a pointer to an array of size_t elements. */
-    blockSizeArray = memPtr;
-    /* The block size value is located at the start of the block, */
-    size_t blockSize = blockSizeArray[0U];
-    /* Set the result value. */
-    result = blockSize;
+    /* Create a pointer to an array of memory pool pointers. */
+    blockHeaderArray = memPtr;
+    /* The memory pool pointer is located at the start of the block. Set the result
+     * value.
+     */
+    result = blockHeaderArray[0U];
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolBlockGetBlockSize ***/
+} /*** end of TbxMemPoolBlockGetPool ***/
 
 
 /************************************************************************************//**
@@ -871,9 +2916,9 @@ static size_t TbxMemPoolBlockGetBlockSize(void const * memPtr)
 ****************************************************************************************/
 static void * TbxMemPoolBlockGetMemPtr(void * dataPtr)
 {
-  void   * result = NULL;
-  void   * blockMemPtr;
-  size_t * blockSizeArray;
+  void   *  result = NULL;
+  void   *  blockMemPtr;
+  tPool  ** blockHeaderArray;
 
   /* Verify parameter. */
   TBX_ASSERT(dataPtr != NULL);
@@ -881,12 +2926,12 @@ static void * TbxMemPoolBlockGetMemPtr(void * dataPtr)
   /* Only continue if the parameter is valid. */
   if (dataPtr != NULL)
   {
-    /* Create a pointer to an array of size_t elements. */
-    blockSizeArray = dataPtr;
-    /* Get pointer to the start of the block, which is one size_t element before the
-     * pointer to the block's data.
+    /* Create a pointer to an array of memory pool pointers. */
+    blockHeaderArray = dataPtr;
+    /* Get pointer to the start of the block, which is one memory pool pointer before
+     * the pointer to the block's data.
      */
-    blockMemPtr = &blockSizeArray[-1];
+    blockMemPtr = &blockHeaderArray[-1];
     /* Set the result value. */
     result = blockMemPtr;
   }
@@ -896,141 +2941,307 @@ static void * TbxMemPoolBlockGetMemPtr(void * dataPtr)
 } /*** end of TbxMemPoolBlockGetMemPtr ***/
 
 
+/************************************************************************************//**
+** \brief     Copies the data of one block to another block. The data is copied word by
+**            word, so the number of bytes is rounded up to a multiple of the address
+**            size. This is safe, because the stride of the blocks is a multiple of their
+**            alignment, which is at least the address size.
+** \param     destPtr Pointer to the data of the destination block.
+** \param     srcPtr Pointer to the data of the source block.
+** \param     size Number of bytes to copy. Should not exceed the block size of either
+**            block.
+**
+****************************************************************************************/
+static void TbxMemPoolBlockCopy(void       * destPtr,
+                                void const * srcPtr,
+                                size_t       size)
+{
+  uintptr_t       * destWordPtr = (uintptr_t *)destPtr;
+  uintptr_t const * srcWordPtr = (uintptr_t const *)srcPtr;
+  size_t            numWords;
+
+  /* Verify parameters. */
+  TBX_ASSERT((destPtr != NULL) && (srcPtr != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((destPtr != NULL) && (srcPtr != NULL))
+  {
+    /* Determine the number of words to copy, rounded up. */
+    numWords = (size + (sizeof(uintptr_t) - 1U)) / sizeof(uintptr_t);
+    /* Copy word by word. */
+    for (size_t idx = 0U; idx < numWords; idx++)
+    {
+      destWordPtr[idx] = srcWordPtr[idx];
+    }
+  }
+} /*** end of TbxMemPoolBlockCopy ***/
+
+
 /****************************************************************************************
 *   B L O C K   L I S T   M A N A G E M E N T   F U N C T I O N S
 ****************************************************************************************/
 
 /************************************************************************************//**
-** \brief     Creates a new and empty linked list that can be used for building a list
-**            with block nodes. Memory needed for the linked list object itself is
-**            allocated on the heap.
-** \return    Pointer to the newly created blocks list if successful, NULL otherwise.
+** \brief     Initializes the linked list with free blocks of the memory pool to be empty.
+**            On ports without support for tagged atomic operations, this includes the
+**            lock that protects the linked list.
+** \param     poolPtr Pointer to the memory pool.
 **
 ****************************************************************************************/
-static tBlockList * TbxMemPoolBlockListCreate(void)
+static void TbxMemPoolBlockListInit(tPool * poolPtr)
 {
-  tBlockList * result;
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
 
-  /* Attempt to create the linked list object on the heap. */
-  result = TbxHeapAllocate(sizeof(tBlockList));
-  /* Only continue with the linked list initialization when the allocation was
-   * successful.
-   */
-  if (result != NULL)
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
   {
-    /* Initialize the linked list to be empty. */
-    *result = NULL;
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+    /* Initialize the list to be empty. The pool is not yet shared, so no need for an
+     * atomic operation.
+     */
+    poolPtr->freeBlockList.ptr = NULL;
+    poolPtr->freeBlockList.tag = 0U;
+#else
+    /* Initialize the list to be empty. */
+    poolPtr->freeBlockListPtr = NULL;
+    /* Initialize the lock that protects the list. */
+    TbxMemPoolLockInit(poolPtr);
+#endif
   }
-
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of TbxMemPoolBlockListCreate ***/
+} /*** end of TbxMemPoolBlockListInit ***/
 
 
 /************************************************************************************//**
-** \brief     Inserts the specified block node into the linked list with block nodes.
-** \param     listPtr Pointer to the linked list with blocks.
-** \param     nodePtr Pointer to the block node to insert.
+** \brief     Inserts the specified blocks into the linked list with free blocks of the
+**            memory pool. The pointer to the next free block is stored in the block's
+**            data, so no separate node is needed. The blocks to insert must already be
+**            linked together, from the first to the last block. This makes it possible
+**            to insert any number of blocks with just one update of the list. On ports
+**            with support for tagged atomic operations, this update is lock-free.
+** \param     poolPtr Pointer to the memory pool.
+** \param     firstBlockPtr Pointer to the memory of the first block to insert.
+** \param     lastBlockPtr Pointer to the memory of the last block to insert. Same as
+**            firstBlockPtr when inserting just one block.
 **
 ****************************************************************************************/
-static void TbxMemPoolBlockListInsert(tBlockList * listPtr, 
-                                      tBlockNode * nodePtr)
+static void TbxMemPoolBlockListInsert(tPool * poolPtr,
+                                      void  * firstBlockPtr,
+                                      void  * lastBlockPtr)
 {
+  void             ** nextBlockPtr;
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+  tTbxPortTaggedPtr   oldHead;
+  tTbxPortTaggedPtr   newHead;
+#endif
+
   /* Verify parameters. */
-  TBX_ASSERT(listPtr != NULL);
-  TBX_ASSERT(nodePtr != NULL);
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(firstBlockPtr != NULL);
+  TBX_ASSERT(lastBlockPtr != NULL);
 
   /* Only continue if the parameters are valid. */
-  if ( (listPtr != NULL) && (nodePtr != NULL) )
+  if ( (poolPtr != NULL) && (firstBlockPtr != NULL) && (lastBlockPtr != NULL) )
   {
-    /* Is the list currently empty? */
-    if (*listPtr == NULL)
-    {
-      /* There is no next node. */
-      nodePtr->nextNodePtr = NULL;
-    }
-    /* Linked list is not empty. */
-    else
+    /* The pointer to the next free block is stored at the start of the block's data. */
+    nextBlockPtr = TbxMemPoolBlockGetDataPtr(lastBlockPtr);
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+    /* Keep trying until the head of the list was updated without another thread
+     * updating it in the meantime.
+     */
+    do
     {
-      /* The new node will be the current head of the list. */
-      nodePtr->nextNodePtr = *listPtr;
+      /* Read the current head of the list. */
+      oldHead = TbxPortAtomicLoadTagged(&poolPtr->freeBlockList);
+      /* The current head of the list becomes the next block of the last block. */
+      *nextBlockPtr = oldHead.ptr;
+      /* The first block becomes the new head. Change the tag as well. */
+      newHead.ptr = firstBlockPtr;
+      newHead.tag = oldHead.tag + 1U;
     }
-    /* Insert the new node at the start of the list. */
-    *listPtr = nodePtr;
+    while (TbxPortAtomicCompareExchangeTagged(&poolPtr->freeBlockList,
+                                              oldHead, newHead) == TBX_FALSE);
+#else
+    /* Obtain mutual exclusive access to the list. */
+    TbxMemPoolLockAcquire(poolPtr);
+    /* The current head of the list becomes the next block of the last block. */
+    *nextBlockPtr = poolPtr->freeBlockListPtr;
+    /* Insert the new blocks at the start of the list. */
+    poolPtr->freeBlockListPtr = firstBlockPtr;
+    /* Release mutual exclusive access to the list. */
+    TbxMemPoolLockRelease(poolPtr);
+#endif
   }
 } /*** end of TbxMemPoolBlockListInsert ***/
 
 
+#if (TBX_CONF_MEMPOOL_MAGAZINE_SIZE == 0U) || (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
 /************************************************************************************//**
-** \brief     Extracts a block node from the linked list with block nodes.
-** \param     listPtr Pointer to the linked list with blocks.
-** \return    Pointer to the block node that was extracted or NULL if the linked list
-**            contained no more nodes.
+** \brief     Extracts a block from the linked list with free blocks of the memory pool.
+**            On ports with support for tagged atomic operations, this is lock-free.
+** \param     poolPtr Pointer to the memory pool.
+** \return    Pointer to the memory of the block that was extracted or NULL if the
+**            linked list contained no more blocks.
 **
 ****************************************************************************************/
-static tBlockNode * TbxMemPoolBlockListExtract(tBlockList * listPtr)
+static void * TbxMemPoolBlockListExtract(tPool * poolPtr)
 {
-  tBlockNode * result = NULL;
+  void                       * result = NULL;
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+  void * volatile const      * nextBlockPtr;
+  tTbxPortTaggedPtr            oldHead;
+  tTbxPortTaggedPtr            newHead;
+#else
+  void                      ** nextBlockPtr;
+#endif
 
   /* Verify parameter. */
-  TBX_ASSERT(listPtr != NULL);
+  TBX_ASSERT(poolPtr != NULL);
 
   /* Only continue if the parameter is valid. */
-  if (listPtr != NULL)
+  if (poolPtr != NULL)
   {
-    /* Only extract a node if the list currently not empty. */
-    if (*listPtr != NULL)
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+    /* Keep trying until the head of the list was updated without another thread
+     * updating it in the meantime.
+     */
+    do
     {
-      /* Get the first node. */
-      result = *listPtr;
-      /* Is there currently only one node in the list? */
-      if ((*listPtr)->nextNodePtr == NULL)
-      {
-        /* Set the list to be empty. */
-        *listPtr = NULL;
-      }
-      /* There are currently at least two nodes in the list. */
-      else
+      /* Read the current head of the list. */
+      oldHead = TbxPortAtomicLoadTagged(&poolPtr->freeBlockList);
+      /* All done if the list is empty. */
+      if (oldHead.ptr == NULL)
       {
-        /* Make the second node the first one. */
-        *listPtr = result->nextNodePtr;
+        break;
       }
+      /* The pointer to the next free block is stored at the start of the block's
+       * data. Note that another thread could have extracted and even written to this
+       * block in the meantime. The read value is then invalid, but the tag change
+       * makes sure that it is never stored.
+       */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(oldHead.ptr);
+      newHead.ptr = *nextBlockPtr;
+      newHead.tag = oldHead.tag + 1U;
     }
+    while (TbxPortAtomicCompareExchangeTagged(&poolPtr->freeBlockList,
+                                              oldHead, newHead) == TBX_FALSE);
+    /* Set the result value. NULL in case the list was empty. */
+    result = oldHead.ptr;
+#else
+    /* Obtain mutual exclusive access to the list. */
+    TbxMemPoolLockAcquire(poolPtr);
+    /* Only extract a block if the list currently not empty. */
+    if (poolPtr->freeBlockListPtr != NULL)
+    {
+      /* Get the first block. */
+      result = poolPtr->freeBlockListPtr;
+      /* The pointer to the next free block is stored at the start of the block's
+       * data. Make the next block the first one.
+       */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(result);
+      poolPtr->freeBlockListPtr = *nextBlockPtr;
+    }
+    /* Release mutual exclusive access to the list. */
+    TbxMemPoolLockRelease(poolPtr);
+#endif
   }
 
   /* Give the result back to the caller. */
   return result;
 } /*** end of TbxMemPoolBlockListExtract ***/
+#endif
 
 
 /************************************************************************************//**
-** \brief     Checks if the linked list with block nodes is empty. So when it does not
-**            contain any nodes.
-** \param     listPtr Pointer to the linked list with blocks.
-** \return    TBX_TRUE if the block list is empty, TBX_FALSE otherwise.
+** \brief     Extracts a number of blocks from the linked list with free blocks of the
+**            memory pool. The extracted blocks remain linked together, from the first to
+**            the last block. On ports without support for tagged atomic operations, this
+**            happens with just one lock of the list.
+** \param     poolPtr Pointer to the memory pool.
+** \param     maxBlocks Maximum number of blocks to extract.
+** \param     firstBlockPtr Pointer to where the pointer to the memory of the first
+**            extracted block is written to.
+** \param     lastBlockPtr Pointer to where the pointer to the memory of the last
+**            extracted block is written to.
+** \return    The number of extracted blocks. Less than maxBlocks, if the linked list
+**            did not contain that many blocks.
 **
 ****************************************************************************************/
-static uint8_t TbxMemPoolBlockListIsEmpty(tBlockList const * listPtr)
+static size_t TbxMemPoolBlockListExtractChain(tPool  * poolPtr,
+                                              size_t   maxBlocks,
+                                              void  ** firstBlockPtr,
+                                              void  ** lastBlockPtr)
 {
-  uint8_t result = TBX_FALSE;
+  size_t    result = 0U;
+  void   *  blockPtr;
+  void   ** nextBlockPtr;
 
-  /* Verify parameter. */
-  TBX_ASSERT(listPtr != NULL);
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(maxBlocks > 0U);
+  TBX_ASSERT(firstBlockPtr != NULL);
+  TBX_ASSERT(lastBlockPtr != NULL);
 
-  /* Only continue if the parameter is valid. */
-  if (listPtr != NULL)
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (maxBlocks > 0U) && (firstBlockPtr != NULL) &&
+       (lastBlockPtr != NULL) )
   {
-    /* Is the list empty? */
-    if (*listPtr == NULL)
+    /* Initialize the chain to be empty. */
+    *firstBlockPtr = NULL;
+    *lastBlockPtr = NULL;
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+    /* Extract the blocks one by one. Each extraction is lock-free. */
+    while (result < maxBlocks)
     {
-      /* Update the result value. */
-      result = TBX_TRUE;
+      /* Attempt to extract a block. */
+      blockPtr = TbxMemPoolBlockListExtract(poolPtr);
+      /* Stop if the list contains no more blocks. */
+      if (blockPtr == NULL)
+      {
+        break;
+      }
+      /* Add the block at the end of the chain. */
+      if (*lastBlockPtr == NULL)
+      {
+        *firstBlockPtr = blockPtr;
+      }
+      else
+      {
+        nextBlockPtr = TbxMemPoolBlockGetDataPtr(*lastBlockPtr);
+        *nextBlockPtr = blockPtr;
+      }
+      *lastBlockPtr = blockPtr;
+      result++;
+    }
+#else
+    /* Obtain mutual exclusive access to the list. */
+    TbxMemPoolLockAcquire(poolPtr);
+    /* The blocks in the list are already linked together. Walk past the blocks to
+     * extract, starting at the head of the list.
+     */
+    blockPtr = poolPtr->freeBlockListPtr;
+    *firstBlockPtr = blockPtr;
+    while ( (blockPtr != NULL) && (result < maxBlocks) )
+    {
+      /* This block is part of the chain. */
+      *lastBlockPtr = blockPtr;
+      result++;
+      /* The pointer to the next free block is stored at the start of the block's
+       * data.
+       */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(blockPtr);
+      blockPtr = *nextBlockPtr;
     }
+    /* The block after the chain becomes the new head of the list. */
+    poolPtr->freeBlockListPtr = blockPtr;
+    /* Release mutual exclusive access to the list. */
+    TbxMemPoolLockRelease(poolPtr);
+#endif
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolBlockListIsEmpty ***/
+} /*** end of TbxMemPoolBlockListExtractChain ***/
 
 
 /*********************************** end of tbx_mempool.c ******************************/
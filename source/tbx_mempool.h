@@ -39,17 +39,112 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_MEMPOOL_STATS_ENABLE
+/** \brief Enable/disable the statistics of the memory pools. When enabled, each memory
+ *         pool counts its used blocks, the peak of its used blocks and its failed
+ *         allocations. Note that it is possible to override this value by adding this
+ *         macro definition to the configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_STATS_ENABLE            (0U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Growth policy that expands a memory pool with a fixed number of blocks. */
+#define TBX_MEMPOOL_GROWTH_FIXED       (0U)
+
+/** \brief Growth policy that doubles the number of blocks of a memory pool. */
+#define TBX_MEMPOOL_GROWTH_DOUBLE      (1U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Handle of a memory pool. Its layout is private to the memory pool module. */
+typedef struct t_tbx_mem_pool tTbxMemPool;
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/** \brief Layout of the statistics of a memory pool. */
+typedef struct
+{
+  /** \brief The number of bytes that fit in one block. */
+  size_t blockSize;
+  /** \brief Total number of blocks in the memory pool. */
+  size_t numBlocks;
+  /** \brief Number of blocks that are currently not allocated. */
+  size_t freeBlocks;
+  /** \brief Number of blocks that are currently allocated. */
+  size_t usedBlocks;
+  /** \brief Highest number of blocks that were allocated at the same time. */
+  size_t peakUsedBlocks;
+  /** \brief Number of allocations that failed and returned NULL, because no free block
+   *         was available.
+   */
+  size_t failedAllocs;
+} tTbxMemPoolStats;
+
+/** \brief Function type for the handler that TbxMemPoolWalkStats() calls with the
+ *         statistics of each memory pool.
+ */
+typedef void (* tTbxMemPoolStatsHandler)(tTbxMemPoolStats const * stats);
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-uint8_t   TbxMemPoolCreate      (size_t   numBlocks,
-                                 size_t   blockSize);
+uint8_t   TbxMemPoolCreate       (size_t   numBlocks,
+                                  size_t   blockSize);
+
+uint8_t   TbxMemPoolCreateAligned(size_t   numBlocks,
+                                  size_t   blockSize,
+                                  size_t   alignment);
+
+void    * TbxMemPoolAllocate     (size_t   size);
+
+void    * TbxMemPoolAllocateAuto (size_t   size);
+
+uint8_t   TbxMemPoolGrow         (size_t   blockSize);
+
+uint8_t   TbxMemPoolSetGrowth    (size_t   blockSize,
+                                  uint8_t  policy,
+                                  size_t   numBlocks);
+
+size_t    TbxMemPoolShrink       (size_t   blockSize,
+                                  size_t   keepBlocks);
+
+void      TbxMemPoolRelease      (void   * memPtr);
+
+void    * TbxMemPoolReallocate   (void   * memPtr,
+                                  size_t   size);
+
+tTbxMemPool * TbxMemPoolGetHandle(size_t   size);
+
+void    * TbxMemPoolAllocateFrom (tTbxMemPool * pool);
+
+void      TbxMemPoolReleaseTo    (tTbxMemPool * pool,
+                                  void        * memPtr);
+
+size_t    TbxMemPoolAllocateBatch(size_t   size,
+                                  void   * ptrs[],
+                                  size_t   count);
+
+void      TbxMemPoolReleaseBatch (void   * ptrs[],
+                                  size_t   count);
 
-void    * TbxMemPoolAllocate    (size_t   size);
+void      TbxMemPoolMagazineFlush(void);
 
-void    * TbxMemPoolAllocateAuto(size_t   size);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+uint8_t   TbxMemPoolGetStats     (size_t                    blockSize,
+                                  tTbxMemPoolStats        * stats);
 
-void      TbxMemPoolRelease     (void   * memPtr);
+void      TbxMemPoolWalkStats    (tTbxMemPoolStatsHandler   handler);
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
 
 
 #ifdef __cplusplus
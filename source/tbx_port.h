@@ -45,12 +45,85 @@ extern "C" {
 #include "tbx_types.h"                      /* MicroTBX port specific types            */
 
 
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#ifndef TBX_PORT_ATOMICS_SUPPORTED
+/** \brief Ports that support atomic operations, set this macro to a value > 0 in their
+ *         tbx_types.h and implement the TbxPortAtomicXxx() functions. If not, MicroTBX
+ *         falls back to using critical sections.
+ */
+#define TBX_PORT_ATOMICS_SUPPORTED               (0U)
+#endif
+
+#ifndef TBX_PORT_ATOMICS_TAGGED_SUPPORTED
+/** \brief Ports that can atomically compare and exchange a pointer together with a tag,
+ *         set this macro to a value > 0 in their tbx_types.h. They then also define the
+ *         tTbxPortTaggedPtr type and implement the TbxPortAtomicXxxTagged() functions.
+ *         This makes ABA-safe lock-free stacks possible. If not, MicroTBX falls back to
+ *         using locks.
+ */
+#define TBX_PORT_ATOMICS_TAGGED_SUPPORTED        (0U)
+#endif
+
+#ifndef TBX_PORT_LOCKS_SUPPORTED
+/** \brief Ports that offer locks, which only block the threads that use the same lock,
+ *         set this macro to a value > 0 in their tbx_types.h. They then also define the
+ *         tTbxPortLock type and implement the TbxPortLockXxx() functions. If not,
+ *         MicroTBX falls back to using critical sections.
+ */
+#define TBX_PORT_LOCKS_SUPPORTED                 (0U)
+#endif
+
+#ifndef TBX_PORT_MEMORY_MAP_SUPPORTED
+/** \brief Ports that run on top of an operating system with virtual memory, set this
+ *         macro to a value > 0 in their tbx_types.h and implement the TbxPortMemoryMap()
+ *         function. Only then can the heap grow beyond TBX_CONF_HEAP_SIZE.
+ */
+#define TBX_PORT_MEMORY_MAP_SUPPORTED            (0U)
+#endif
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-tTbxPortCpuSR TbxPortInterruptsDisable(void);
+tTbxPortCpuSR TbxPortInterruptsDisable    (void);
+
+void          TbxPortInterruptsRestore    (tTbxPortCpuSR           prevCpuSr);
+
+#if (TBX_PORT_ATOMICS_SUPPORTED > 0U)
+size_t        TbxPortAtomicLoad           (size_t volatile const * valuePtr);
+
+uint8_t       TbxPortAtomicCompareExchange(size_t volatile       * valuePtr,
+                                           size_t                  expected,
+                                           size_t                  desired);
+
+void        * TbxPortAtomicLoadPtr        (void * volatile const * valuePtr);
+
+void          TbxPortAtomicStorePtr       (void * volatile       * valuePtr,
+                                           void                  * value);
+#endif /* (TBX_PORT_ATOMICS_SUPPORTED > 0U) */
+
+#if (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U)
+tTbxPortTaggedPtr TbxPortAtomicLoadTagged (tTbxPortTaggedPtr volatile const * valuePtr);
+
+uint8_t       TbxPortAtomicCompareExchangeTagged(tTbxPortTaggedPtr volatile * valuePtr,
+                                                 tTbxPortTaggedPtr            expected,
+                                                 tTbxPortTaggedPtr            desired);
+#endif /* (TBX_PORT_ATOMICS_TAGGED_SUPPORTED > 0U) */
+
+#if (TBX_PORT_LOCKS_SUPPORTED > 0U)
+void          TbxPortLockInit             (tTbxPortLock          * lockPtr);
+
+void          TbxPortLockAcquire          (tTbxPortLock          * lockPtr);
+
+void          TbxPortLockRelease          (tTbxPortLock          * lockPtr);
+#endif /* (TBX_PORT_LOCKS_SUPPORTED > 0U) */
 
-void          TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr);
+#if (TBX_PORT_MEMORY_MAP_SUPPORTED > 0U)
+void        * TbxPortMemoryMap            (size_t                  size,
+                                           uint8_t                 hugePages);
+#endif /* (TBX_PORT_MEMORY_MAP_SUPPORTED > 0U) */
 
 
 #ifdef __cplusplus
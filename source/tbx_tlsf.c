@@ -0,0 +1,654 @@
+/************************************************************************************//**
+* \file         tbx_tlsf.c
+* \brief        Two-Level Segregated Fit memory allocator source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Alignment of all allocated memory and block sizes. */
+#define TBX_TLSF_ALIGN_SIZE            (1UL << TBX_TLSF_ALIGN_SIZE_LOG2)
+
+/** \brief Blocks smaller than this size are all managed by the first first level. */
+#define TBX_TLSF_SMALL_BLOCK_SIZE      (1UL << TBX_TLSF_FL_INDEX_SHIFT)
+
+/** \brief Size of the largest block that the allocator can manage. */
+#define TBX_TLSF_BLOCK_SIZE_MAX        (((size_t)1U << TBX_CONF_TLSF_FL_INDEX_MAX) - \
+                                        TBX_TLSF_ALIGN_SIZE)
+
+/** \brief Number of bytes at the start of each block, that are reserved for its header.
+ *         The free list pointers of a block are only needed while the block is free and
+ *         are therefore stored in its data area.
+ */
+#define TBX_TLSF_BLOCK_OVERHEAD        ((offsetof(tTlsfBlock, nextFreePtr) + \
+                                         (TBX_TLSF_ALIGN_SIZE - 1U)) & \
+                                        ~(TBX_TLSF_ALIGN_SIZE - 1U))
+
+/** \brief Minimum size of the data area of a block. It must be able to hold the free
+ *         list pointers.
+ */
+#define TBX_TLSF_BLOCK_SIZE_MIN        (((2U * sizeof(void *)) + \
+                                         (TBX_TLSF_ALIGN_SIZE - 1U)) & \
+                                        ~(TBX_TLSF_ALIGN_SIZE - 1U))
+
+/** \brief Flag in the block size that indicates that the block is free. */
+#define TBX_TLSF_BLOCK_FREE_FLAG       (0x1U)
+
+/** \brief Flag in the block size that indicates that the previous block is free. */
+#define TBX_TLSF_BLOCK_PREV_FREE_FLAG  (0x2U)
+
+/** \brief Mask for the flags in the block size. */
+#define TBX_TLSF_BLOCK_FLAGS_MASK      (TBX_TLSF_BLOCK_FREE_FLAG | \
+                                        TBX_TLSF_BLOCK_PREV_FREE_FLAG)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a block. A block consists of a header, followed by its data area.
+ *         The blocks are physically located one after the other, ending with a zero
+ *         sized sentinel block.
+ */
+typedef struct t_tlsf_block
+{
+  /** \brief Pointer to the physically previous block. Only valid if it is free. */
+  struct t_tlsf_block * prevPhysPtr;
+  /** \brief Size of the data area in bytes, combined with the block flags. */
+  size_t                sizeFlags;
+  /** \brief Pointer to the next block in the free list. Only valid if free. */
+  struct t_tlsf_block * nextFreePtr;
+  /** \brief Pointer to the previous block in the free list. Only valid if free. */
+  struct t_tlsf_block * prevFreePtr;
+} tTlsfBlock;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t      TbxTlsfBitFindFirst   (uint32_t           value);
+
+static uint8_t      TbxTlsfBitFindLast    (size_t             value);
+
+static void         TbxTlsfMapping        (size_t             size,
+                                           uint8_t          * flIdx,
+                                           uint8_t          * slIdx);
+
+static tTlsfBlock * TbxTlsfBlockFind      (tTbxTlsf         * tlsf,
+                                           size_t             size);
+
+static void         TbxTlsfBlockInsert    (tTbxTlsf         * tlsf,
+                                           tTlsfBlock       * block);
+
+static void         TbxTlsfBlockRemove    (tTbxTlsf         * tlsf,
+                                           tTlsfBlock       * block);
+
+static size_t       TbxTlsfBlockGetSize   (tTlsfBlock const * block);
+
+static tTlsfBlock * TbxTlsfBlockGetNext   (tTlsfBlock const * block);
+
+
+/************************************************************************************//**
+** \brief     Creates a new TLSF allocator on top of the memory supplied by the caller.
+**            A Two-Level Segregated Fit (TLSF) allocator offers malloc() and free() like
+**            functionality with a bounded execution time. Both allocating and releasing
+**            memory are O(1) operations. Released memory is immediately merged with
+**            neighboring free memory, to keep fragmentation low. This makes it suitable
+**            for data of varying sizes in real-time systems, where memory pools would
+**            need a separate pool for each size. The TLSF allocator's administration is
+**            stored at the start of the supplied memory. For example, the memory can be
+**            allocated with TbxHeapAllocate() or provided by a heap region.
+** \param     memPtr Pointer to the start of the memory that the TLSF allocator manages.
+** \param     size Total size in bytes of the memory that the TLSF allocator manages.
+** \return    Pointer to the newly created TLSF allocator if successful, NULL otherwise.
+**            Make sure to store the pointer because it serves as a handle to the TLSF
+**            allocator, which is needed when calling the other TLSF functions.
+**
+****************************************************************************************/
+tTbxTlsf * TbxTlsfCreate(void   * memPtr,
+                         size_t   size)
+{
+  tTbxTlsf   * result = NULL;
+  tTlsfBlock * block;
+  tTlsfBlock * sentinel;
+  uint8_t    * poolPtr;
+  size_t       padding;
+  size_t       adminSize;
+  size_t       blockSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (size > 0U) )
+  {
+    /* Determine how many padding bytes are needed to align the TLSF allocator's
+     * administration.
+     */
+    padding = (TBX_TLSF_ALIGN_SIZE - ((size_t)(uintptr_t)memPtr & \
+                                      (TBX_TLSF_ALIGN_SIZE - 1U))) & \
+              (TBX_TLSF_ALIGN_SIZE - 1U);
+    /* Determine the number of bytes needed for the administration, such that the first
+     * block is aligned as well.
+     */
+    adminSize = (sizeof(tTbxTlsf) + (TBX_TLSF_ALIGN_SIZE - 1U)) & \
+                ~(TBX_TLSF_ALIGN_SIZE - 1U);
+    /* Only continue if the memory is large enough to hold the administration, one block
+     * of the minimum size and the sentinel block.
+     */
+    if ( (size > padding) && ((size - padding) >= (adminSize + \
+         (2U * TBX_TLSF_BLOCK_OVERHEAD) + TBX_TLSF_BLOCK_SIZE_MIN)) )
+    {
+      /* Initialize the TLSF allocator's administration. */
+      result = (tTbxTlsf *)(void *)&((uint8_t *)memPtr)[padding];
+      result->flBitmap = 0U;
+      for (uint8_t flIdx = 0U; flIdx < TBX_TLSF_FL_INDEX_COUNT; flIdx++)
+      {
+        result->slBitmap[flIdx] = 0U;
+        for (uint8_t slIdx = 0U; slIdx < TBX_TLSF_SL_INDEX_COUNT; slIdx++)
+        {
+          result->freeLists[flIdx][slIdx] = NULL;
+        }
+      }
+      result->freeBytes = 0U;
+      /* Determine the size of the data area of the one block that initially spans all
+       * the memory. Its size is limited to what the TLSF allocator can manage.
+       */
+      blockSize = (size - padding - adminSize - (2U * TBX_TLSF_BLOCK_OVERHEAD)) & \
+                  ~(TBX_TLSF_ALIGN_SIZE - 1U);
+      if (blockSize > TBX_TLSF_BLOCK_SIZE_MAX)
+      {
+        blockSize = TBX_TLSF_BLOCK_SIZE_MAX;
+      }
+      /* Initialize the block that spans all the memory. */
+      poolPtr = &((uint8_t *)memPtr)[padding + adminSize];
+      block = (tTlsfBlock *)(void *)poolPtr;
+      block->prevPhysPtr = NULL;
+      block->sizeFlags = blockSize | TBX_TLSF_BLOCK_FREE_FLAG;
+      /* Initialize the sentinel block. It is zero sized and never free. This way merging
+       * with the next block never goes past the end of the memory.
+       */
+      sentinel = TbxTlsfBlockGetNext(block);
+      sentinel->prevPhysPtr = block;
+      sentinel->sizeFlags = TBX_TLSF_BLOCK_PREV_FREE_FLAG;
+      /* Store the memory boundaries, needed to verify pointers upon release. */
+      result->poolStartPtr = poolPtr;
+      result->poolEndPtr = (uint8_t *)(void *)sentinel;
+      /* Add the block to the free lists. */
+      TbxTlsfBlockInsert(result, block);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes from the TLSF allocator. The execution
+**            time does not depend on the number of blocks that are allocated or free.
+** \param     tlsf Pointer to a previously created TLSF allocator to operate on.
+** \param     size The number of bytes to allocate.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxTlsfAllocate(tTbxTlsf * tlsf,
+                       size_t     size)
+{
+  void       * result = NULL;
+  tTlsfBlock * block;
+  tTlsfBlock * remainder;
+  size_t       sizeWanted;
+  size_t       blockSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(tlsf != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid and the size can be managed. */
+  if ( (tlsf != NULL) && (size > 0U) && (size <= TBX_TLSF_BLOCK_SIZE_MAX) )
+  {
+    /* Align the desired size and make sure the block can hold the free list pointers,
+     * once it is released again.
+     */
+    sizeWanted = (size + (TBX_TLSF_ALIGN_SIZE - 1U)) & ~(TBX_TLSF_ALIGN_SIZE - 1U);
+    if (sizeWanted < TBX_TLSF_BLOCK_SIZE_MIN)
+    {
+      sizeWanted = TBX_TLSF_BLOCK_SIZE_MIN;
+    }
+    /* Obtain mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionEnter();
+    /* Find a free block that is at least the desired size. */
+    block = TbxTlsfBlockFind(tlsf, sizeWanted);
+    /* Only continue if a free block was found. */
+    if (block != NULL)
+    {
+      /* Take the block out of the free lists. */
+      TbxTlsfBlockRemove(tlsf, block);
+      blockSize = TbxTlsfBlockGetSize(block);
+      /* Is the block large enough to split off a new free block from its end? */
+      if (blockSize >= (sizeWanted + TBX_TLSF_BLOCK_OVERHEAD + TBX_TLSF_BLOCK_SIZE_MIN))
+      {
+        /* Shrink the block to the desired size. */
+        block->sizeFlags = sizeWanted | (block->sizeFlags & TBX_TLSF_BLOCK_FLAGS_MASK);
+        /* Create the remainder block right after it. */
+        remainder = TbxTlsfBlockGetNext(block);
+        remainder->prevPhysPtr = block;
+        remainder->sizeFlags = (blockSize - sizeWanted - TBX_TLSF_BLOCK_OVERHEAD) | \
+                               TBX_TLSF_BLOCK_FREE_FLAG;
+        /* Inform the block after the remainder that its previous block is free. */
+        TbxTlsfBlockGetNext(remainder)->prevPhysPtr = remainder;
+        TbxTlsfBlockGetNext(remainder)->sizeFlags |= TBX_TLSF_BLOCK_PREV_FREE_FLAG;
+        /* Add the remainder to the free lists. */
+        TbxTlsfBlockInsert(tlsf, remainder);
+      }
+      /* Mark the block as used. */
+      block->sizeFlags &= ~((size_t)TBX_TLSF_BLOCK_FREE_FLAG);
+      TbxTlsfBlockGetNext(block)->sizeFlags &= ~((size_t)TBX_TLSF_BLOCK_PREV_FREE_FLAG);
+      /* The allocated memory is the data area of the block. */
+      result = &((uint8_t *)(void *)block)[TBX_TLSF_BLOCK_OVERHEAD];
+    }
+    /* Release mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxTlsfAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases previously allocated memory, such that it can be allocated again.
+**            The memory is immediately merged with its physically neighboring blocks,
+**            if these are free. The execution time does not depend on the number of
+**            blocks that are allocated or free.
+** \param     tlsf Pointer to a previously created TLSF allocator to operate on.
+** \param     memPtr Pointer to the memory to release. It must have been allocated with
+**            TbxTlsfAllocate() from the same TLSF allocator.
+**
+****************************************************************************************/
+void TbxTlsfRelease(tTbxTlsf * tlsf,
+                    void     * memPtr)
+{
+  tTlsfBlock * block;
+  tTlsfBlock * neighbor;
+
+  /* Verify parameters. */
+  TBX_ASSERT(tlsf != NULL);
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (tlsf != NULL) && (memPtr != NULL) )
+  {
+    /* Obtain mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionEnter();
+    /* Verify that the memory belongs to this TLSF allocator. */
+    TBX_ASSERT((uint8_t *)memPtr >= &tlsf->poolStartPtr[TBX_TLSF_BLOCK_OVERHEAD]);
+    TBX_ASSERT((uint8_t *)memPtr < tlsf->poolEndPtr);
+    /* Only continue if the memory belongs to this TLSF allocator. */
+    if ( ((uint8_t *)memPtr >= &tlsf->poolStartPtr[TBX_TLSF_BLOCK_OVERHEAD]) &&
+         ((uint8_t *)memPtr < tlsf->poolEndPtr) )
+    {
+      /* The block header is located right before the memory. */
+      block = (tTlsfBlock *)(void *)((uint8_t *)memPtr - TBX_TLSF_BLOCK_OVERHEAD);
+      /* Releasing a block that is already free is not allowed. */
+      TBX_ASSERT((block->sizeFlags & TBX_TLSF_BLOCK_FREE_FLAG) == 0U);
+      /* Only continue if the block is actually in use. */
+      if ((block->sizeFlags & TBX_TLSF_BLOCK_FREE_FLAG) == 0U)
+      {
+        /* Is the physically previous block free? */
+        if ((block->sizeFlags & TBX_TLSF_BLOCK_PREV_FREE_FLAG) != 0U)
+        {
+          /* Merge the block into the previous block. */
+          neighbor = block->prevPhysPtr;
+          TbxTlsfBlockRemove(tlsf, neighbor);
+          neighbor->sizeFlags += TBX_TLSF_BLOCK_OVERHEAD + TbxTlsfBlockGetSize(block);
+          block = neighbor;
+        }
+        /* Is the physically next block free? */
+        neighbor = TbxTlsfBlockGetNext(block);
+        if ((neighbor->sizeFlags & TBX_TLSF_BLOCK_FREE_FLAG) != 0U)
+        {
+          /* Merge the next block into this block. */
+          TbxTlsfBlockRemove(tlsf, neighbor);
+          block->sizeFlags += TBX_TLSF_BLOCK_OVERHEAD + TbxTlsfBlockGetSize(neighbor);
+        }
+        /* Mark the block as free and inform the next block about this. */
+        block->sizeFlags |= TBX_TLSF_BLOCK_FREE_FLAG;
+        neighbor = TbxTlsfBlockGetNext(block);
+        neighbor->prevPhysPtr = block;
+        neighbor->sizeFlags |= TBX_TLSF_BLOCK_PREV_FREE_FLAG;
+        /* Add the block to the free lists. */
+        TbxTlsfBlockInsert(tlsf, block);
+      }
+    }
+    /* Release mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionExit();
+  }
+} /*** end of TbxTlsfRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of bytes in the free blocks of the TLSF allocator.
+**            Note that due to fragmentation, the largest possible allocation can be
+**            smaller than this.
+** \param     tlsf Pointer to a previously created TLSF allocator to operate on.
+** \return    Number of free bytes in the TLSF allocator.
+**
+****************************************************************************************/
+size_t TbxTlsfGetFree(tTbxTlsf const * tlsf)
+{
+  size_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(tlsf != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (tlsf != NULL)
+  {
+    /* Obtain mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionEnter();
+    /* Read out the number of free bytes. */
+    result = tlsf->freeBytes;
+    /* Release mutual exclusive access to the TLSF allocator. */
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the index of the least significant bit that is set.
+** \param     value The value to scan. Must not be zero.
+** \return    Bit index.
+**
+****************************************************************************************/
+static uint8_t TbxTlsfBitFindFirst(uint32_t value)
+{
+  uint8_t result = 0U;
+
+#if defined(__GNUC__)
+  /* Use the compiler's built-in function, which typically maps to a single CPU
+   * instruction.
+   */
+  result = (uint8_t)__builtin_ctz(value);
+#else
+  /* Scan the bits, starting at the least significant one. */
+  while ((value & ((uint32_t)1U << result)) == 0U)
+  {
+    result++;
+  }
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfBitFindFirst ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the index of the most significant bit that is set.
+** \param     value The value to scan. Must not be zero.
+** \return    Bit index.
+**
+****************************************************************************************/
+static uint8_t TbxTlsfBitFindLast(size_t value)
+{
+  uint8_t result;
+
+#if defined(__GNUC__)
+  /* Use the compiler's built-in function, which typically maps to a single CPU
+   * instruction.
+   */
+  result = (uint8_t)(((sizeof(unsigned long long) * 8U) - 1U) - \
+                     (size_t)__builtin_clzll((unsigned long long)value));
+#else
+  /* Scan the bits, starting at the most significant one. */
+  result = (uint8_t)((sizeof(size_t) * 8U) - 1U);
+  while ((value & ((size_t)1U << result)) == 0U)
+  {
+    result--;
+  }
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfBitFindLast ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the first and second level indices of the free list that holds
+**            blocks of the specified size.
+** \param     size Block size in bytes.
+** \param     flIdx Pointer to where the first level index is written to.
+** \param     slIdx Pointer to where the second level index is written to.
+**
+****************************************************************************************/
+static void TbxTlsfMapping(size_t    size,
+                           uint8_t * flIdx,
+                           uint8_t * slIdx)
+{
+  uint8_t bitIdx;
+
+  /* Small blocks are all managed by the first first level, with linearly spaced second
+   * levels.
+   */
+  if (size < TBX_TLSF_SMALL_BLOCK_SIZE)
+  {
+    *flIdx = 0U;
+    *slIdx = (uint8_t)(size >> TBX_TLSF_ALIGN_SIZE_LOG2);
+  }
+  /* For larger blocks, the first level is the power of two range the size falls in and
+   * the second level splits this range linearly.
+   */
+  else
+  {
+    bitIdx = TbxTlsfBitFindLast(size);
+    *slIdx = (uint8_t)((size >> (bitIdx - TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2)) ^ \
+                       TBX_TLSF_SL_INDEX_COUNT);
+    *flIdx = (uint8_t)(bitIdx - (TBX_TLSF_FL_INDEX_SHIFT - 1U));
+  }
+} /*** end of TbxTlsfMapping ***/
+
+
+/************************************************************************************//**
+** \brief     Finds a free block that is at least the specified size. The size is first
+**            rounded up to the next second level boundary. This way any block in the
+**            found free list is large enough, so no list needs to be searched.
+** \param     tlsf Pointer to the TLSF allocator to operate on.
+** \param     size Desired block size in bytes.
+** \return    Pointer to the free block if found, NULL otherwise.
+**
+****************************************************************************************/
+static tTlsfBlock * TbxTlsfBlockFind(tTbxTlsf * tlsf,
+                                     size_t     size)
+{
+  tTlsfBlock * result = NULL;
+  size_t       sizeSearch = size;
+  uint32_t     flMap = 0U;
+  uint32_t     slMap;
+  uint8_t      flIdx;
+  uint8_t      slIdx;
+
+  /* Round the size up to the next second level boundary. */
+  if (sizeSearch >= TBX_TLSF_SMALL_BLOCK_SIZE)
+  {
+    sizeSearch += ((size_t)1U << (TbxTlsfBitFindLast(sizeSearch) - \
+                                  TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2)) - 1U;
+  }
+  TbxTlsfMapping(sizeSearch, &flIdx, &slIdx);
+  /* Only continue if the first level is in range. */
+  if (flIdx < TBX_TLSF_FL_INDEX_COUNT)
+  {
+    /* Check for free blocks in this or a higher second level of the first level. */
+    slMap = tlsf->slBitmap[flIdx] & (0xFFFFFFFFUL << slIdx);
+    /* None available? */
+    if (slMap == 0U)
+    {
+      /* Check for free blocks in a higher first level. */
+      if ((flIdx + 1U) < 32U)
+      {
+        flMap = tlsf->flBitmap & (0xFFFFFFFFUL << (flIdx + 1U));
+      }
+      /* Is a higher first level with free blocks available? */
+      if (flMap != 0U)
+      {
+        /* Any of its second levels has blocks that are large enough. */
+        flIdx = TbxTlsfBitFindFirst(flMap);
+        slMap = tlsf->slBitmap[flIdx];
+      }
+    }
+    /* Was a free list with suitable blocks found? */
+    if (slMap != 0U)
+    {
+      /* Take the first block from the free list. */
+      slIdx = TbxTlsfBitFindFirst(slMap);
+      result = (tTlsfBlock *)tlsf->freeLists[flIdx][slIdx];
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfBlockFind ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a free block to the front of its free list.
+** \param     tlsf Pointer to the TLSF allocator to operate on.
+** \param     block Pointer to the block to add.
+**
+****************************************************************************************/
+static void TbxTlsfBlockInsert(tTbxTlsf   * tlsf,
+                               tTlsfBlock * block)
+{
+  tTlsfBlock * headPtr;
+  uint8_t      flIdx;
+  uint8_t      slIdx;
+
+  /* Determine the free list that this block belongs to. */
+  TbxTlsfMapping(TbxTlsfBlockGetSize(block), &flIdx, &slIdx);
+  headPtr = (tTlsfBlock *)tlsf->freeLists[flIdx][slIdx];
+  /* Link the block at the front of the free list. */
+  block->prevFreePtr = NULL;
+  block->nextFreePtr = headPtr;
+  if (headPtr != NULL)
+  {
+    headPtr->prevFreePtr = block;
+  }
+  tlsf->freeLists[flIdx][slIdx] = block;
+  /* Flag that this free list now has a free block. */
+  tlsf->flBitmap |= ((uint32_t)1U << flIdx);
+  tlsf->slBitmap[flIdx] |= ((uint32_t)1U << slIdx);
+  /* Update the number of free bytes. */
+  tlsf->freeBytes += TbxTlsfBlockGetSize(block);
+} /*** end of TbxTlsfBlockInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Removes a free block from its free list.
+** \param     tlsf Pointer to the TLSF allocator to operate on.
+** \param     block Pointer to the block to remove.
+**
+****************************************************************************************/
+static void TbxTlsfBlockRemove(tTbxTlsf   * tlsf,
+                               tTlsfBlock * block)
+{
+  uint8_t flIdx;
+  uint8_t slIdx;
+
+  /* Determine the free list that this block belongs to. */
+  TbxTlsfMapping(TbxTlsfBlockGetSize(block), &flIdx, &slIdx);
+  /* Unlink the block from its neighbors in the free list. */
+  if (block->nextFreePtr != NULL)
+  {
+    block->nextFreePtr->prevFreePtr = block->prevFreePtr;
+  }
+  if (block->prevFreePtr != NULL)
+  {
+    block->prevFreePtr->nextFreePtr = block->nextFreePtr;
+  }
+  /* The block was the head of the free list. */
+  else
+  {
+    tlsf->freeLists[flIdx][slIdx] = block->nextFreePtr;
+    /* Did the free list become empty? */
+    if (block->nextFreePtr == NULL)
+    {
+      /* Flag that this free list no longer has a free block. */
+      tlsf->slBitmap[flIdx] &= ~((uint32_t)1U << slIdx);
+      if (tlsf->slBitmap[flIdx] == 0U)
+      {
+        tlsf->flBitmap &= ~((uint32_t)1U << flIdx);
+      }
+    }
+  }
+  /* Update the number of free bytes. */
+  tlsf->freeBytes -= TbxTlsfBlockGetSize(block);
+} /*** end of TbxTlsfBlockRemove ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the size of the block's data area.
+** \param     block Pointer to the block.
+** \return    Size of the block's data area in bytes.
+**
+****************************************************************************************/
+static size_t TbxTlsfBlockGetSize(tTlsfBlock const * block)
+{
+  /* Strip the flags from the size. */
+  return block->sizeFlags & ~((size_t)TBX_TLSF_BLOCK_FLAGS_MASK);
+} /*** end of TbxTlsfBlockGetSize ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the block that is physically located right after the block.
+** \param     block Pointer to the block.
+** \return    Pointer to the next block.
+**
+****************************************************************************************/
+static tTlsfBlock * TbxTlsfBlockGetNext(tTlsfBlock const * block)
+{
+  /* The next block starts right after the data area of this block. */
+  return (tTlsfBlock *)(void *)&((uint8_t *)(void *)block)[TBX_TLSF_BLOCK_OVERHEAD + \
+                                 TbxTlsfBlockGetSize(block)];
+} /*** end of TbxTlsfBlockGetNext ***/
+
+
+/*********************************** end of tbx_tlsf.c *********************************/
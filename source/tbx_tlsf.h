@@ -0,0 +1,144 @@
+/************************************************************************************//**
+* \file         tbx_tlsf.h
+* \brief        Two-Level Segregated Fit memory allocator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_TLSF_H
+#define TBX_TLSF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2
+/** \brief Configure the log2 of the number of second level free lists, per first level
+ *         free list. A higher value reduces the amount of memory wasted on rounding up
+ *         allocation requests, at the cost of a larger control structure. Must be in
+ *         the range 1..5. Note that it is possible to override this value by adding
+ *         this macro definition to the configuration header file.
+ */
+#define TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2        (3U)
+#endif
+
+#ifndef TBX_CONF_TLSF_FL_INDEX_MAX
+/** \brief Configure the log2 of the size limit of the memory blocks that the allocator
+ *         manages. For example, 15 means that blocks can be up to 32 kB. A higher value
+ *         makes larger allocations possible, at the cost of a larger control structure.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_TLSF_FL_INDEX_MAX               (15U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Log2 of the alignment of all allocated memory and block sizes. */
+#define TBX_TLSF_ALIGN_SIZE_LOG2       (3U)
+
+/** \brief Number of second level free lists, per first level free list. */
+#define TBX_TLSF_SL_INDEX_COUNT        (1UL << TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2)
+
+/** \brief Blocks smaller than (1 << TBX_TLSF_FL_INDEX_SHIFT) bytes all share the first
+ *         first level free list. Its second level free lists are spaced linearly.
+ */
+#define TBX_TLSF_FL_INDEX_SHIFT        (TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2 + \
+                                        TBX_TLSF_ALIGN_SIZE_LOG2)
+
+/** \brief Number of first level free lists. */
+#define TBX_TLSF_FL_INDEX_COUNT        (TBX_CONF_TLSF_FL_INDEX_MAX - \
+                                        TBX_TLSF_FL_INDEX_SHIFT + 1U)
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2 < 1U) || (TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2 > 5U)
+#error "TBX_CONF_TLSF_SL_INDEX_COUNT_LOG2 must be in the range 1..5."
+#endif
+
+#if (TBX_CONF_TLSF_FL_INDEX_MAX <= TBX_TLSF_FL_INDEX_SHIFT) || \
+    (TBX_TLSF_FL_INDEX_COUNT > 32U)
+#error "TBX_CONF_TLSF_FL_INDEX_MAX is out of range."
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a TLSF allocator. Its pointer serves as the handle to the TLSF
+ *         allocator which is obtained after creation of the TLSF allocator and which is
+ *         needed in the other functions of this module. Note that its elements should be
+ *         considered private and only be accessed internally by this TLSF module.
+ */
+typedef struct
+{
+  /** \brief Bitmap with a bit set for each first level that has a free block. */
+  uint32_t   flBitmap;
+  /** \brief Bitmaps with a bit set for each second level that has a free block. */
+  uint32_t   slBitmap[TBX_TLSF_FL_INDEX_COUNT];
+  /** \brief Heads of the free lists, one per first and second level combination. */
+  void     * freeLists[TBX_TLSF_FL_INDEX_COUNT][TBX_TLSF_SL_INDEX_COUNT];
+  /** \brief Pointer to the start of the memory that blocks are taken from. */
+  uint8_t  * poolStartPtr;
+  /** \brief Pointer to the end of the memory that blocks are taken from. */
+  uint8_t  * poolEndPtr;
+  /** \brief Total number of bytes in the free blocks. */
+  size_t     freeBytes;
+} tTbxTlsf;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxTlsf * TbxTlsfCreate  (void           * memPtr,
+                           size_t           size);
+
+void     * TbxTlsfAllocate(tTbxTlsf       * tlsf,
+                           size_t           size);
+
+void       TbxTlsfRelease (tTbxTlsf       * tlsf,
+                           void           * memPtr);
+
+size_t     TbxTlsfGetFree (tTbxTlsf const * tlsf);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_TLSF_H */
+/*********************************** end of tbx_tlsf.h *********************************/
@@ -41,6 +41,9 @@
 #include "unity.h"                               /* Unity unit test framework          */
 #include "unittests.h"                           /* Unit tests header                  */
 #include <sys/time.h>                            /* Time definitions                   */
+#if defined(TBX_PORT_THREAD_LOCAL)
+#include <pthread.h>                             /* POSIX threads                      */
+#endif
 
 
 /****************************************************************************************
@@ -54,6 +57,13 @@ typedef struct
   uint8_t  data[8];
 } tListTestMsg;
 
+/** \brief Information of a thread that runs the memory pool stress test. */
+typedef struct
+{
+  size_t id;
+  size_t errorCnt;
+} tMemPoolStressInfo;
+
 
 /****************************************************************************************
 * Local data declarations
@@ -70,6 +80,25 @@ const size_t memPoolBlockSize = 16;
 /** \brief Array with block pointers allocated from the test memory pool. */
 void * memPoolAllocatedBlocks[3];
 
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/** \brief Number of memory pools that the memory pool statistics handler was called for. */
+static size_t memPoolStatsCnt = 0;
+#endif
+
+/** \brief Memory that the test heap region is created on. */
+static uint8_t heapRegionMem[128];
+
+/** \brief Memory that the heap regions of the TLSF, buddy and handle based allocator
+ *         tests are created on. This way these tests do not use the default heap.
+ */
+static uint8_t allocatorTestMem[2048];
+
+/** \brief Memory that the heap region of the bitmap pool test is created on. It is not
+ *         shared with the other tests, because a bitmap pool stays linked in the list
+ *         with bitmap pools.
+ */
+static uint8_t bitPoolTestMem[512];
+
 /** \brief Test message A for the linked list module. */
 static tListTestMsg listTestMsgA = 
 {
@@ -151,6 +180,22 @@ uint8_t compareListMsg(void const * item1, void const * item2)
 } /*** end of compareListMsg ***/
 
 
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Handler function that gets called with the statistics of each memory pool.
+** \param     stats Statistics of the memory pool.
+**
+****************************************************************************************/
+void memPoolStatsHandler(tTbxMemPoolStats const * stats)
+{
+  /* Count the memory pools. */
+  memPoolStatsCnt++;
+  /* The free and used blocks should always add up to the total number of blocks. */
+  TEST_ASSERT_EQUAL_UINT32(stats->numBlocks, stats->freeBlocks + stats->usedBlocks);
+} /*** end of memPoolStatsHandler ***/
+#endif
+
+
 /************************************************************************************//**
 ** \brief     Tests that verifies that the version macros are present.
 **
@@ -309,8 +354,13 @@ void test_TbxHeapGetFree_ShouldReturnActualFreeSize(void)
   initialFreeHeap = TbxHeapGetFree();
   /* Heap should not be zero. */
   TEST_ASSERT_GREATER_THAN(0, initialFreeHeap);
+#if defined(TBX_CONF_HEAP_GROW_SIZE) && (TBX_CONF_HEAP_GROW_SIZE > 0U)
+  /* The heap can still grow, so more than just the heap buffer should be free. */
+  TEST_ASSERT_GREATER_THAN(TBX_CONF_HEAP_SIZE, initialFreeHeap);
+#else
   /* First time that anything gets allocated means that the full heap should be free. */
   TEST_ASSERT_EQUAL(TBX_CONF_HEAP_SIZE, initialFreeHeap);
+#endif
   /* Allocate some memory from the heap. */
   mem = TbxHeapAllocate(allocSize);
   /* Get the current free heap size. */
@@ -428,6 +478,417 @@ void test_TbxHeapAllocate_ShouldAlignToAddressSize(void)
 } /*** end of test_TbxHeapAllocate_ShouldAlignToAddressSize ***/
 
 
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+**
+****************************************************************************************/
+void test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams(void)
+{
+  size_t initialFreeHeap;
+  void * mem;
+
+  /* Get the initial free heap size. */
+  initialFreeHeap = TbxHeapGetFree();
+  /* It should not be possible to allocate zero bytes. */
+  mem = TbxHeapAllocateAligned(0, 16);
+  /* Make sure the allocation failed. */
+  TEST_ASSERT_NULL(mem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to use an alignment of zero. */
+  mem = TbxHeapAllocateAligned(16, 0);
+  /* Make sure the allocation failed. */
+  TEST_ASSERT_NULL(mem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to use an alignment that is not a power of two. */
+  mem = TbxHeapAllocateAligned(16, 24);
+  /* Make sure the allocation failed. */
+  TEST_ASSERT_NULL(mem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Nothing should have been allocated from the heap. */
+  TEST_ASSERT_EQUAL(initialFreeHeap, TbxHeapGetFree());
+} /*** end of test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that aligned allocations return memory with a correctly aligned
+**            start address.
+**
+****************************************************************************************/
+void test_TbxHeapAllocateAligned_ShouldReturnAlignedMemory(void)
+{
+  void * mem;
+  const size_t alignments[] = { 16, 64, 32 };
+
+  /* Perform an allocation for each alignment in the table. */
+  for (size_t idx = 0; idx < (sizeof(alignments)/sizeof(alignments[0])); idx++)
+  {
+    /* First allocate a single byte, to make it likely that padding is needed. */
+    mem = TbxHeapAllocate(1);
+    /* Make sure the allocation worked. */
+    TEST_ASSERT_NOT_NULL(mem);
+    /* Perform the aligned allocation. */
+    mem = TbxHeapAllocateAligned(8, alignments[idx]);
+    /* Make sure the allocation worked. */
+    TEST_ASSERT_NOT_NULL(mem);
+    /* Make sure the start address is aligned. */
+    TEST_ASSERT_EQUAL(0, (uintptr_t)mem & (alignments[idx] - 1U));
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapAllocateAligned_ShouldReturnAlignedMemory ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that tagged allocations are taken from the heap, just like untagged
+**            allocations.
+**
+****************************************************************************************/
+void test_TbxHeapAllocateTagged_ShouldAllocateFromHeap(void)
+{
+  void * mem;
+  size_t initialFreeHeap;
+
+  /* Store the initial free heap size. */
+  initialFreeHeap = TbxHeapGetFree();
+  /* Perform a tagged allocation. */
+  mem = TbxHeapAllocateTagged(8, 1);
+  /* Make sure the allocation worked. */
+  TEST_ASSERT_NOT_NULL(mem);
+  /* Make sure it was taken from the heap. */
+  TEST_ASSERT_EQUAL(initialFreeHeap - 8U, TbxHeapGetFree());
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapAllocateTagged_ShouldAllocateFromHeap ***/
+
+#if defined(TBX_CONF_HEAP_CHUNK_SIZE) && (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Thread function that performs two small heap allocations.
+** \param     arg Pointer to the array where the allocated pointers should be stored.
+** \return    Always NULL.
+**
+****************************************************************************************/
+static void * heapChunkThread(void * arg)
+{
+  void ** mem = (void **)arg;
+
+  /* Perform two small allocations, which should come from the chunk of this thread. */
+  mem[0] = TbxHeapAllocate(sizeof(void *));
+  mem[1] = TbxHeapAllocate(sizeof(void *));
+  return NULL;
+} /*** end of heapChunkThread ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that small allocations are served from a chunk that belongs to the
+**            calling thread.
+**
+****************************************************************************************/
+void test_TbxHeapAllocate_ShouldServeSmallAllocationsFromThreadChunk(void)
+{
+  pthread_t   thread;
+  void      * threadMem[2] = { NULL, NULL };
+  void      * mem;
+
+  /* Perform two small allocations from another thread. */
+  TEST_ASSERT_EQUAL(0, pthread_create(&thread, NULL, heapChunkThread, threadMem));
+  TEST_ASSERT_EQUAL(0, pthread_join(thread, NULL));
+  TEST_ASSERT_NOT_NULL(threadMem[0]);
+  TEST_ASSERT_NOT_NULL(threadMem[1]);
+  /* A new thread starts with a new chunk, so its allocations should be adjacent. */
+  TEST_ASSERT_EQUAL_PTR(&((uint8_t *)threadMem[0])[sizeof(void *)], threadMem[1]);
+  /* A small allocation from this thread should not continue in the chunk of the other
+   * thread, which is where it would end up without chunks.
+   */
+  mem = TbxHeapAllocate(sizeof(void *));
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_TRUE(mem != &((uint8_t *)threadMem[1])[sizeof(void *)]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapAllocate_ShouldServeSmallAllocationsFromThreadChunk ***/
+#endif
+
+
+#if defined(TBX_CONF_HEAP_GROW_SIZE) && (TBX_CONF_HEAP_GROW_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Tests that the heap grows when an allocation does not fit in the heap
+**            buffer.
+**
+****************************************************************************************/
+void test_TbxHeapAllocate_ShouldGrowBeyondHeapBuffer(void)
+{
+  uint8_t      * mem;
+  size_t         initialFreeHeap;
+  size_t         idx;
+  const size_t   allocSize = TBX_CONF_HEAP_SIZE + 1U;
+
+  /* Store the initial free heap size, which includes the memory the heap can grow by. */
+  initialFreeHeap = TbxHeapGetFree();
+  TEST_ASSERT_GREATER_THAN(allocSize, initialFreeHeap);
+  /* Allocate more than the entire heap buffer. This only works if the heap grows. */
+  mem = TbxHeapAllocate(allocSize);
+  TEST_ASSERT_NOT_NULL(mem);
+  /* Make sure the entire grown memory is accessible. */
+  for (idx = 0U; idx < allocSize; idx++)
+  {
+    mem[idx] = (uint8_t)idx;
+  }
+  for (idx = 0U; idx < allocSize; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)idx, mem[idx]);
+  }
+  /* The free heap size should have dropped by at least the allocated size. */
+  TEST_ASSERT_LESS_THAN(initialFreeHeap - TBX_CONF_HEAP_SIZE, TbxHeapGetFree());
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapAllocate_ShouldGrowBeyondHeapBuffer ***/
+#endif
+
+
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Handler function that gets called by the heap trace to obtain a timestamp.
+** \return    Fixed timestamp value, such that the unit tests can check it.
+**
+****************************************************************************************/
+static uint32_t heapTraceTimestampHandler(void)
+{
+  return 1234U;
+} /*** end of heapTraceTimestampHandler ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the heap trace functions properly check their parameters.
+**
+****************************************************************************************/
+void test_TbxHeapTrace_ShouldAssertOnInvalidParams(void)
+{
+  tTbxHeapTraceEntry entries[2];
+
+  /* Pass an invalid timestamp handler. */
+  TbxHeapTraceSetTimestampHandler(NULL);
+  TEST_ASSERT_EQUAL_UINT32(1, assertionCnt);
+  /* Pass an invalid log buffer. */
+  TEST_ASSERT_EQUAL(0U, TbxHeapTraceGetLog(NULL, 2U));
+  TEST_ASSERT_EQUAL_UINT32(2, assertionCnt);
+  /* Pass an invalid log buffer size. */
+  TEST_ASSERT_EQUAL(0U, TbxHeapTraceGetLog(entries, 0U));
+  TEST_ASSERT_EQUAL_UINT32(3, assertionCnt);
+  /* Pass an invalid tag. */
+  TEST_ASSERT_EQUAL(0U, TbxHeapTraceGetTagTotal(TBX_CONF_HEAP_TRACE_TAGS));
+  TEST_ASSERT_EQUAL_UINT32(4, assertionCnt);
+} /*** end of test_TbxHeapTrace_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the heap trace logs allocations and keeps track of the tag
+**            totals and the peak heap usage.
+**
+****************************************************************************************/
+void test_TbxHeapTrace_ShouldRecordAllocations(void)
+{
+  tTbxHeapTraceEntry   entries[TBX_CONF_HEAP_TRACE_LOG_SIZE];
+  size_t               numEntries;
+  void               * mem;
+  size_t               tooLarge;
+  size_t               initialTagTotal;
+  size_t               initialPeak;
+  const size_t         allocSize = 12U;
+  const uint8_t        tag = 2U;
+
+  /* Configure the timestamp handler. */
+  TbxHeapTraceSetTimestampHandler(heapTraceTimestampHandler);
+  /* Store the initial tag total. */
+  initialTagTotal = TbxHeapTraceGetTagTotal(tag);
+  /* Perform a tagged allocation that works and one that fails. */
+  mem = TbxHeapAllocateTagged(allocSize, tag);
+  TEST_ASSERT_NOT_NULL(mem);
+  tooLarge = TbxHeapGetFree() + 1U;
+  TEST_ASSERT_NULL(TbxHeapAllocateTagged(tooLarge, tag));
+  /* Only the successful allocation should count towards the tag total. */
+  TEST_ASSERT_EQUAL(initialTagTotal + allocSize, TbxHeapTraceGetTagTotal(tag));
+  /* Both allocations should be the most recent entries in the log. */
+  numEntries = TbxHeapTraceGetLog(entries, TBX_CONF_HEAP_TRACE_LOG_SIZE);
+  TEST_ASSERT_GREATER_OR_EQUAL(2U, numEntries);
+  TEST_ASSERT_EQUAL_PTR(mem, entries[numEntries - 2U].memPtr);
+  TEST_ASSERT_EQUAL(allocSize, entries[numEntries - 2U].size);
+  TEST_ASSERT_EQUAL_UINT8(tag, entries[numEntries - 2U].tag);
+  TEST_ASSERT_EQUAL_UINT32(1234U, entries[numEntries - 2U].timestamp);
+  TEST_ASSERT_NULL(entries[numEntries - 1U].memPtr);
+  TEST_ASSERT_EQUAL(tooLarge, entries[numEntries - 1U].size);
+  TEST_ASSERT_EQUAL_UINT8(tag, entries[numEntries - 1U].tag);
+  TEST_ASSERT_EQUAL_UINT32(1234U, entries[numEntries - 1U].timestamp);
+  /* Aligned allocations bypass the thread-local heap chunks, so the peak usage should
+   * go up by at least the allocated size.
+   */
+  initialPeak = TbxHeapTraceGetPeak();
+  mem = TbxHeapAllocateAligned(allocSize, sizeof(void *));
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_GREATER_OR_EQUAL(initialPeak + allocSize, TbxHeapTraceGetPeak());
+  /* Untagged allocations should be logged with the default tag. */
+  numEntries = TbxHeapTraceGetLog(entries, TBX_CONF_HEAP_TRACE_LOG_SIZE);
+  TEST_ASSERT_EQUAL_PTR(mem, entries[numEntries - 1U].memPtr);
+  TEST_ASSERT_EQUAL_UINT8(TBX_HEAP_TAG_NONE, entries[numEntries - 1U].tag);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapTrace_ShouldRecordAllocations ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+**
+****************************************************************************************/
+void test_TbxHeapRegionCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxHeapRegion * region;
+
+  /* It should not be possible to create a heap region without memory. */
+  region = TbxHeapRegionCreate(NULL, sizeof(heapRegionMem));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(region);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a heap region of zero bytes. */
+  region = TbxHeapRegionCreate(heapRegionMem, 0);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(region);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a heap region that is too small to even hold
+   * its own administration.
+   */
+  region = TbxHeapRegionCreate(heapRegionMem, sizeof(tTbxHeapRegion));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(region);
+  /* Make sure no assertion was triggered, because the parameters themselves are
+   * valid.
+   */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapRegionCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that memory can be allocated from a heap region and that it is
+**            independent from the default heap.
+**
+****************************************************************************************/
+void test_TbxHeapRegionAllocate_ShouldAllocateFromRegion(void)
+{
+  tTbxHeapRegion * region;
+  size_t           heapFreeBefore;
+  size_t           regionFree;
+  uint8_t        * mem;
+
+  /* Store the free size of the default heap. */
+  heapFreeBefore = TbxHeapGetFree();
+  /* Create the heap region. */
+  region = TbxHeapRegionCreate(heapRegionMem, sizeof(heapRegionMem));
+  /* Make sure the creation worked. */
+  TEST_ASSERT_NOT_NULL(region);
+  /* Part of the memory is used for the region's administration. */
+  regionFree = TbxHeapRegionGetFree(region);
+  TEST_ASSERT_GREATER_THAN(0, regionFree);
+  TEST_ASSERT_LESS_THAN(sizeof(heapRegionMem), regionFree);
+
+  /* Allocate from the heap region. */
+  mem = TbxHeapRegionAllocate(region, 1);
+  /* Make sure the allocation worked and that it is located in the region's memory. */
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_GREATER_OR_EQUAL((uintptr_t)&heapRegionMem[0], (uintptr_t)mem);
+  TEST_ASSERT_LESS_THAN((uintptr_t)&heapRegionMem[sizeof(heapRegionMem)], 
+                        (uintptr_t)mem);
+  /* The allocated size should be aligned to the address size. */
+  TEST_ASSERT_EQUAL(regionFree - sizeof(void *), TbxHeapRegionGetFree(region));
+
+  /* Perform an aligned allocation from the heap region. */
+  mem = TbxHeapRegionAllocateAligned(region, 4, 16);
+  /* Make sure the allocation worked and that the start address is aligned. */
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_EQUAL(0, (uintptr_t)mem & 15U);
+
+  /* Allocating more than what is free in the region should not work. */
+  regionFree = TbxHeapRegionGetFree(region);
+  mem = TbxHeapRegionAllocate(region, regionFree + 1);
+  TEST_ASSERT_NULL(mem);
+  /* Allocating exactly what is free in the region should work. */
+  mem = TbxHeapRegionAllocate(region, regionFree);
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_EQUAL(0, TbxHeapRegionGetFree(region));
+
+  /* None of this should have affected the default heap. */
+  TEST_ASSERT_EQUAL(heapFreeBefore, TbxHeapGetFree());
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapRegionAllocate_ShouldAllocateFromRegion ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that rewinding a heap region to a previously made mark, releases
+**            everything that was allocated after the mark. Also with nested marks.
+**
+****************************************************************************************/
+void test_TbxHeapRegionRewind_ShouldReleaseToMark(void)
+{
+  tTbxHeapRegion * region;
+  size_t           outerMark;
+  size_t           innerMark;
+  size_t           freeAtOuterMark;
+  size_t           freeAtInnerMark;
+  void           * outerMem;
+  void           * innerMem;
+
+  /* Create the heap region, which acts as the arena. */
+  region = TbxHeapRegionCreate(heapRegionMem, sizeof(heapRegionMem));
+  TEST_ASSERT_NOT_NULL(region);
+
+  /* Make the outer mark and allocate some memory in its scope. */
+  outerMark = TbxHeapRegionMark(region);
+  freeAtOuterMark = TbxHeapRegionGetFree(region);
+  outerMem = TbxHeapRegionAllocate(region, 16);
+  TEST_ASSERT_NOT_NULL(outerMem);
+
+  /* Make the nested inner mark and allocate some memory in its scope. */
+  innerMark = TbxHeapRegionMark(region);
+  freeAtInnerMark = TbxHeapRegionGetFree(region);
+  innerMem = TbxHeapRegionAllocate(region, 24);
+  TEST_ASSERT_NOT_NULL(innerMem);
+  TEST_ASSERT_LESS_THAN(freeAtInnerMark, TbxHeapRegionGetFree(region));
+
+  /* Rewinding to the inner mark should release just the inner allocation. */
+  TbxHeapRegionRewind(region, innerMark);
+  TEST_ASSERT_EQUAL(freeAtInnerMark, TbxHeapRegionGetFree(region));
+  /* The released memory should be reused by the next allocation. */
+  TEST_ASSERT_EQUAL_PTR(innerMem, TbxHeapRegionAllocate(region, 24));
+
+  /* Rewinding to the outer mark should release everything. */
+  TbxHeapRegionRewind(region, outerMark);
+  TEST_ASSERT_EQUAL(freeAtOuterMark, TbxHeapRegionGetFree(region));
+  TEST_ASSERT_EQUAL_PTR(outerMem, TbxHeapRegionAllocate(region, 16));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Rewinding forward, to a mark that was already discarded, should not work. */
+  TbxHeapRegionRewind(region, innerMark + 32);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapRegionRewind_ShouldReleaseToMark ***/
+
+
 /************************************************************************************//**
 ** \brief     Tests that an assertion is triggered if you try to set an invalid seed
 **            initialization handler.
@@ -1458,6 +1919,1207 @@ void test_TbxMemPoolAllocateAuto_CannotAllocateSmallerSize(void)
 } /*** end of test_TbxMemPoolAllocateAuto_CannotAllocateSmallerSize ***/
 
 
+/************************************************************************************//**
+** \brief     Tests that memory cannot be allocated with a size larger than the size
+**            class index of the memory pools covers, if no memory pool exists for it.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CannotAllocateBeyondIndex(void)
+{
+  void * result;
+
+  /* Try to allocate a block that is larger than all the existing memory pools and
+   * larger than what the size class index covers.
+   */
+  result = TbxMemPoolAllocate(1024U);
+  /* Make sure the allocation failed. */
+  TEST_ASSERT_NULL(result);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_CannotAllocateBeyondIndex ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the blocks of a newly created memory pool are located adjacent
+**            to each other in memory and are handed out by ascending address.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreate_ShouldCreateContiguousBlocks(void)
+{
+  uint8_t      * allocBlocks[3];
+  const size_t   blockSize = 40U;
+
+  /* Create a new memory pool with three blocks. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(3U, blockSize));
+  /* Allocate all its blocks. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+  }
+  /* Make sure the blocks are adjacent, with the same distance between them. */
+  TEST_ASSERT_GREATER_THAN((uintptr_t)allocBlocks[0], (uintptr_t)allocBlocks[1]);
+  TEST_ASSERT_GREATER_OR_EQUAL(blockSize, (size_t)(allocBlocks[1] - allocBlocks[0]));
+  TEST_ASSERT_EQUAL(allocBlocks[1] - allocBlocks[0], allocBlocks[2] - allocBlocks[1]);
+  /* Release the blocks again. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreate_ShouldCreateContiguousBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the released blocks can be allocated again, after the calling
+**            thread moved the blocks in its magazines back to their memory pools.
+**
+****************************************************************************************/
+void test_TbxMemPoolMagazineFlush_ShouldKeepBlocksAvailable(void)
+{
+  uint8_t      * allocBlocks[3];
+  const size_t   blockSize = 40U;
+
+  /* Allocate all blocks of the memory pool, twice. */
+  for (size_t loopIdx = 0U; loopIdx < 2U; loopIdx++)
+  {
+    for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+    {
+      allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+      TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+    }
+    /* Make sure the memory pool is now exhausted. */
+    TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+    /* Release the blocks again and flush the magazines. */
+    for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+    {
+      TbxMemPoolRelease(allocBlocks[idx]);
+    }
+    TbxMemPoolMagazineFlush();
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolMagazineFlush_ShouldKeepBlocksAvailable ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a memory pool is expanded according to its growth policy.
+**
+****************************************************************************************/
+void test_TbxMemPoolGrow_ShouldFollowGrowthPolicy(void)
+{
+  void         * allocBlocks[5];
+  const size_t   blockSize = 1U;
+
+  /* The growth policy can only be configured for an existing memory pool. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxMemPoolSetGrowth(blockSize,
+                                                         TBX_MEMPOOL_GROWTH_DOUBLE, 0U));
+  /* Create the memory pool with one block and let it double with each expansion. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(1U, blockSize));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolSetGrowth(blockSize,
+                                                      TBX_MEMPOOL_GROWTH_DOUBLE, 0U));
+  /* Expand it twice, which should result in 1 + 1 + 2 = 4 blocks. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGrow(blockSize));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGrow(blockSize));
+  /* Switch to adding one block at a time and expand it once more to get 5 blocks. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolSetGrowth(blockSize,
+                                                      TBX_MEMPOOL_GROWTH_FIXED, 1U));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGrow(blockSize));
+  /* Make sure exactly 5 blocks can be allocated. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+  }
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Release the blocks again and give the memory of the memory pool back, such that
+   * other memory pools can reuse it.
+   */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  TbxMemPoolMagazineFlush();
+  TEST_ASSERT_EQUAL_UINT32(5U, TbxMemPoolShrink(blockSize, 0U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolGrow_ShouldFollowGrowthPolicy ***/
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Tests that the statistics of the memory pools follow the allocations.
+**
+****************************************************************************************/
+void test_TbxMemPoolGetStats_ShouldCountBlocks(void)
+{
+  tTbxMemPoolStats   stats;
+  void             * allocBlocks[3];
+  const size_t       blockSize = 12U;
+
+  /* Statistics can only be obtained for an existing memory pool. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxMemPoolGetStats(blockSize, &stats));
+  /* Create the memory pool with two blocks. Its statistics should start at zero. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(2U, blockSize));
+  /* Expand by exactly one block, independent of the configured growth policy. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolSetGrowth(blockSize,
+                                                      TBX_MEMPOOL_GROWTH_FIXED, 1U));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGetStats(blockSize, &stats));
+  TEST_ASSERT_EQUAL_UINT32(blockSize, stats.blockSize);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.numBlocks);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.freeBlocks);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.usedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.peakUsedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.failedAllocs);
+  /* Allocate both blocks, after which another allocation should fail. */
+  allocBlocks[0] = TbxMemPoolAllocate(blockSize);
+  TEST_ASSERT_NOT_NULL(allocBlocks[0]);
+  allocBlocks[1] = TbxMemPoolAllocate(blockSize);
+  TEST_ASSERT_NOT_NULL(allocBlocks[1]);
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGetStats(blockSize, &stats));
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.freeBlocks);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.usedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.peakUsedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.failedAllocs);
+  /* An allocation that only succeeds after expanding the memory pool, should not count
+   * as a failed allocation.
+   */
+  allocBlocks[2] = TbxMemPoolAllocateAuto(blockSize);
+  TEST_ASSERT_NOT_NULL(allocBlocks[2]);
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGetStats(blockSize, &stats));
+  TEST_ASSERT_EQUAL_UINT32(3U, stats.numBlocks);
+  TEST_ASSERT_EQUAL_UINT32(3U, stats.usedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(3U, stats.peakUsedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.failedAllocs);
+  /* Release the blocks again. The peak should remain. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  TbxMemPoolMagazineFlush();
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolGetStats(blockSize, &stats));
+  TEST_ASSERT_EQUAL_UINT32(3U, stats.freeBlocks);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.usedBlocks);
+  TEST_ASSERT_EQUAL_UINT32(3U, stats.peakUsedBlocks);
+  /* Walk the statistics of all memory pools. There should be at least two. */
+  memPoolStatsCnt = 0U;
+  TbxMemPoolWalkStats(memPoolStatsHandler);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2U, memPoolStatsCnt);
+  /* Give the memory of the memory pool back, such that other memory pools can reuse
+   * it.
+   */
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolShrink(blockSize, 0U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolGetStats_ShouldCountBlocks ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that the parameters are verified when creating an aligned memory pool.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreateAligned_ShouldAssertOnInvalidParams(void)
+{
+  /* Pass an alignment of zero. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxMemPoolCreateAligned(1U, 20U, 0U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Pass an alignment that is not a power of two. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxMemPoolCreateAligned(1U, 20U, 24U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+} /*** end of test_TbxMemPoolCreateAligned_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the blocks of an aligned memory pool are aligned, also after it
+**            was extended.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreateAligned_ShouldAlignBlocks(void)
+{
+  void         * allocBlocks[3];
+  const size_t   blockSize = 20U;
+  const size_t   alignment = 32U;
+
+  /* Create the memory pool with two aligned blocks and extend it with one more. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreateAligned(2U, blockSize, alignment));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(1U, blockSize));
+  /* Extending it with blocks of a larger alignment should not be possible. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxMemPoolCreateAligned(1U, blockSize,
+                                                             alignment * 2U));
+  /* Allocate all its blocks and make sure they are aligned. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)allocBlocks[idx] & (alignment - 1U));
+  }
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Release the blocks again and give the memory of the memory pool back, such that
+   * other memory pools can reuse it.
+   */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  TbxMemPoolMagazineFlush();
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolShrink(blockSize, 0U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreateAligned_ShouldAlignBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the parameters are verified when allocating and releasing a
+**            batch of blocks.
+**
+****************************************************************************************/
+void test_TbxMemPoolBatch_ShouldAssertOnInvalidParams(void)
+{
+  void * allocBlocks[1] = { NULL };
+
+  /* Pass a zero size. */
+  TEST_ASSERT_EQUAL_UINT32(0U, TbxMemPoolAllocateBatch(0U, allocBlocks, 1U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Pass an invalid array. */
+  TEST_ASSERT_EQUAL_UINT32(0U, TbxMemPoolAllocateBatch(40U, NULL, 1U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Release an invalid array. */
+  TbxMemPoolReleaseBatch(NULL, 1U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Release an array with an invalid entry. */
+  TbxMemPoolReleaseBatch(allocBlocks, 1U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+} /*** end of test_TbxMemPoolBatch_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a batch of blocks can be allocated and released, also when the
+**            blocks belong to different memory pools.
+**
+****************************************************************************************/
+void test_TbxMemPoolBatch_CanAllocateAndRelease(void)
+{
+  void         * allocBlocks[4];
+  const size_t   blockSize = 40U;
+
+  /* Request one block more than the memory pool with 3 blocks holds. */
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolAllocateBatch(blockSize, allocBlocks, 4U));
+  /* Make sure all blocks are different. */
+  TEST_ASSERT_NOT_NULL(allocBlocks[0]);
+  TEST_ASSERT_TRUE(allocBlocks[0] != allocBlocks[1]);
+  TEST_ASSERT_TRUE(allocBlocks[0] != allocBlocks[2]);
+  TEST_ASSERT_TRUE(allocBlocks[1] != allocBlocks[2]);
+  /* Add a block of another memory pool to the batch. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(1U, 1U));
+  allocBlocks[3] = TbxMemPoolAllocate(1U);
+  TEST_ASSERT_NOT_NULL(allocBlocks[3]);
+  /* Release all blocks at once. */
+  TbxMemPoolReleaseBatch(allocBlocks, 4U);
+  /* Make sure all blocks can be allocated again. */
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolAllocateBatch(blockSize, allocBlocks, 3U));
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  TbxMemPoolReleaseBatch(allocBlocks, 3U);
+  TbxMemPoolMagazineFlush();
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolBatch_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a slab, which reused the memory of a larger released slab, can be
+**            released again once all its blocks are free.
+**
+****************************************************************************************/
+void test_TbxMemPoolShrink_ShouldReleaseReusedSlabs(void)
+{
+  void         * allocBlocks[3];
+  const size_t   blockSize = 12U;
+
+  /* Create the memory pool with a slab of four blocks and release it again. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(4U, blockSize));
+  TEST_ASSERT_EQUAL_UINT32(4U, TbxMemPoolShrink(blockSize, 0U));
+  /* Add a slab of three blocks, which reuses the memory of the released slab. The
+   * remaining memory is too small for another slab, so it becomes part of the new slab.
+   */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(3U, blockSize));
+  /* Allocate and release all its blocks. */
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+  }
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  TbxMemPoolMagazineFlush();
+  /* All three blocks should be released with the slab. */
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolShrink(blockSize, 0U));
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolShrink_ShouldReleaseReusedSlabs ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a memory pool releases its slabs with only free blocks and that
+**            their memory is reused when blocks are added afterwards.
+**
+****************************************************************************************/
+void test_TbxMemPoolShrink_ShouldReuseFreeSlabs(void)
+{
+  void         * allocBlock;
+  size_t         heapFree;
+  const size_t   blockSize = 12U;
+
+  /* Create the memory pool with two slabs of two blocks. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(2U, blockSize));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(2U, blockSize));
+  /* Allocate a block, which comes from the slab that was added last. */
+  allocBlock = TbxMemPoolAllocate(blockSize);
+  TEST_ASSERT_NOT_NULL(allocBlock);
+  TbxMemPoolMagazineFlush();
+  /* Only the slab without allocated blocks can be released. */
+  TEST_ASSERT_EQUAL_UINT32(2U, TbxMemPoolShrink(blockSize, 0U));
+  /* Release the block again. Keeping two free blocks should prevent the release of the
+   * remaining slab.
+   */
+  TbxMemPoolRelease(allocBlock);
+  TbxMemPoolMagazineFlush();
+  TEST_ASSERT_EQUAL_UINT32(0U, TbxMemPoolShrink(blockSize, 2U));
+  TEST_ASSERT_EQUAL_UINT32(2U, TbxMemPoolShrink(blockSize, 0U));
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Adding blocks again should reuse the memory of the released slabs. */
+  heapFree = TbxHeapGetFree();
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(2U, blockSize));
+  TEST_ASSERT_EQUAL_UINT32(heapFree, TbxHeapGetFree());
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolShrink_ShouldReuseFreeSlabs ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the memory pool handle functions trigger an assertion error
+**            upon detection of invalid parameters.
+**
+****************************************************************************************/
+void test_TbxMemPoolHandle_ShouldAssertOnInvalidParams(void)
+{
+  tTbxMemPool * pool;
+  void        * otherBlock;
+  int           dummy = 0;
+
+  /* Pass a zero size. */
+  TEST_ASSERT_NULL(TbxMemPoolGetHandle(0U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Pass an invalid handle. */
+  TEST_ASSERT_NULL(TbxMemPoolAllocateFrom(NULL));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Pass a handle that does not refer to a memory pool. */
+  (void)TbxMemPoolAllocateFrom((tTbxMemPool *)(void *)&dummy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Release to an invalid handle. */
+  TbxMemPoolReleaseTo(NULL, &dummy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Release an invalid pointer. */
+  pool = TbxMemPoolGetHandle(40U);
+  TEST_ASSERT_NOT_NULL(pool);
+  TbxMemPoolReleaseTo(pool, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Release a block to a memory pool that it does not belong to. */
+  otherBlock = TbxMemPoolAllocate(1U);
+  TEST_ASSERT_NOT_NULL(otherBlock);
+  TbxMemPoolReleaseTo(pool, otherBlock);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Release it properly. */
+  TbxMemPoolRelease(otherBlock);
+  TbxMemPoolMagazineFlush();
+} /*** end of test_TbxMemPoolHandle_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that blocks can be allocated from and released to a memory pool,
+**            through its handle.
+**
+****************************************************************************************/
+void test_TbxMemPoolHandle_CanAllocateAndRelease(void)
+{
+  tTbxMemPool  * pool;
+  void         * allocBlocks[3];
+  size_t         idx;
+  const size_t   blockSize = 40U;
+
+  /* Obtain the handle of the memory pool with 3 blocks. */
+  pool = TbxMemPoolGetHandle(blockSize);
+  TEST_ASSERT_NOT_NULL(pool);
+  /* There is no memory pool with blocks this large. */
+  TEST_ASSERT_NULL(TbxMemPoolGetHandle(SIZE_MAX));
+  /* Allocate all blocks through the handle. */
+  for (idx = 0U; idx < 3U; idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocateFrom(pool);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+  }
+  /* The memory pool should now be exhausted. */
+  TEST_ASSERT_NULL(TbxMemPoolAllocateFrom(pool));
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Release all blocks through the handle. */
+  for (idx = 0U; idx < 3U; idx++)
+  {
+    TbxMemPoolReleaseTo(pool, allocBlocks[idx]);
+  }
+  /* The blocks are now available for the regular allocation. */
+  allocBlocks[0] = TbxMemPoolAllocate(blockSize);
+  TEST_ASSERT_NOT_NULL(allocBlocks[0]);
+  TbxMemPoolRelease(allocBlocks[0]);
+  TbxMemPoolMagazineFlush();
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolHandle_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the reallocation of memory pool blocks triggers an assertion
+**            error upon detection of invalid parameters.
+**
+****************************************************************************************/
+void test_TbxMemPoolReallocate_ShouldAssertOnInvalidParams(void)
+{
+  void   * allocBlock;
+  size_t   invalidBlock[4] = { 0 };
+
+  /* Pass a zero size. */
+  allocBlock = TbxMemPoolAllocate(1U);
+  TEST_ASSERT_NOT_NULL(allocBlock);
+  TEST_ASSERT_NULL(TbxMemPoolReallocate(allocBlock, 0U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  TbxMemPoolRelease(allocBlock);
+
+  /* Pass memory that was not allocated from a memory pool. */
+  TEST_ASSERT_NULL(TbxMemPoolReallocate(&invalidBlock[2], 1U));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  TbxMemPoolMagazineFlush();
+} /*** end of test_TbxMemPoolReallocate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the reallocation of a memory pool block keeps the block, as long
+**            as the new size fits, and otherwise moves its contents to another block.
+**
+****************************************************************************************/
+void test_TbxMemPoolReallocate_ShouldGrowInPlaceOrMove(void)
+{
+  uint8_t * allocBlock;
+  uint8_t * reallocBlock;
+  void    * allocBlocks[3];
+  size_t    idx;
+
+  /* Allocate a block from the memory pool with block size 12. */
+  allocBlock = TbxMemPoolReallocate(NULL, 12U);
+  TEST_ASSERT_NOT_NULL(allocBlock);
+  /* Shrinking and growing again within the block size keeps the block. */
+  TEST_ASSERT_EQUAL_PTR(allocBlock, TbxMemPoolReallocate(allocBlock, 6U));
+  TEST_ASSERT_EQUAL_PTR(allocBlock, TbxMemPoolReallocate(allocBlock, 12U));
+  /* Fill the block with a test pattern. */
+  for (idx = 0U; idx < 12U; idx++)
+  {
+    allocBlock[idx] = (uint8_t)idx;
+  }
+  /* Growing beyond a size that any memory pool holds fails, but keeps the block. */
+  TEST_ASSERT_NULL(TbxMemPoolReallocate(allocBlock, TBX_CONF_HEAP_SIZE));
+  /* Growing beyond the block size moves the contents to the memory pool with block
+   * size 40.
+   */
+  reallocBlock = TbxMemPoolReallocate(allocBlock, 40U);
+  TEST_ASSERT_NOT_NULL(reallocBlock);
+  TEST_ASSERT_TRUE(reallocBlock != allocBlock);
+  for (idx = 0U; idx < 12U; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)idx, reallocBlock[idx]);
+  }
+  /* The original block was released, so both blocks of its memory pool are free. */
+  TEST_ASSERT_EQUAL_UINT32(2U, TbxMemPoolAllocateBatch(12U, allocBlocks, 3U));
+  TbxMemPoolReleaseBatch(allocBlocks, 2U);
+  TbxMemPoolRelease(reallocBlock);
+  TbxMemPoolMagazineFlush();
+  /* No other tests need the blocks of the memory pools with block sizes 1, 12 and 40
+   * anymore. Give their memory back, such that other memory pools can reuse it.
+   */
+  TEST_ASSERT_EQUAL_UINT32(1U, TbxMemPoolShrink(1U, 0U));
+  TEST_ASSERT_EQUAL_UINT32(2U, TbxMemPoolShrink(12U, 0U));
+  TEST_ASSERT_EQUAL_UINT32(3U, TbxMemPoolShrink(40U, 0U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolReallocate_ShouldGrowInPlaceOrMove ***/
+
+
+#if defined(TBX_PORT_THREAD_LOCAL)
+/************************************************************************************//**
+** \brief     Thread function that repeatedly allocates and releases blocks from the
+**            memory pool with 12 byte blocks.
+** \param     arg Pointer to the information of the thread.
+** \return    Always NULL.
+**
+****************************************************************************************/
+static void * memPoolStressThread(void * arg)
+{
+  tMemPoolStressInfo * info = (tMemPoolStressInfo *)arg;
+  size_t             * allocBlocks[2];
+  const size_t         blockSize = 12U;
+
+  for (size_t loopIdx = 0U; loopIdx < 5000U; loopIdx++)
+  {
+    /* Allocate two blocks and mark them with the identifier of this thread. The other
+     * threads can hold all blocks at this point, so an allocation is allowed to fail.
+     */
+    for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+    {
+      allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+      if (allocBlocks[idx] != NULL)
+      {
+        *allocBlocks[idx] = info->id;
+      }
+    }
+    /* A block that was handed out to more than one thread, no longer holds the
+     * identifier of this thread.
+     */
+    for (size_t idx = 0; idx < (sizeof(allocBlocks)/sizeof(allocBlocks[0])); idx++)
+    {
+      if (allocBlocks[idx] != NULL)
+      {
+        if (*allocBlocks[idx] != info->id)
+        {
+          info->errorCnt++;
+        }
+        TbxMemPoolRelease(allocBlocks[idx]);
+      }
+    }
+    /* Regularly move the blocks in the magazines back to the memory pool, such that
+     * the threads also compete for the free blocks of the memory pool itself.
+     */
+    if ((loopIdx % 8U) == 0U)
+    {
+      TbxMemPoolMagazineFlush();
+    }
+  }
+  /* Move the remaining blocks in the magazines back to the memory pool. */
+  TbxMemPoolMagazineFlush();
+  return NULL;
+} /*** end of memPoolStressThread ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that multiple threads can allocate and release blocks from the same
+**            memory pool at the same time. On ports with tagged atomic operations this
+**            runs the lock-free free block stack. With magazines enabled, it also runs
+**            the thread-local magazines.
+**
+****************************************************************************************/
+void test_TbxMemPoolStress_ShouldAllocateAndReleaseFromThreads(void)
+{
+  pthread_t            threads[4];
+  tMemPoolStressInfo   info[4];
+  void               * allocBlocks[4];
+  const size_t         numBlocks = sizeof(allocBlocks)/sizeof(allocBlocks[0]);
+  const size_t         blockSize = 12U;
+
+  /* Give the memory pool fewer blocks than the threads can hold together. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(numBlocks, blockSize));
+  /* Start the threads and wait for them to finish. */
+  for (size_t idx = 0; idx < (sizeof(threads)/sizeof(threads[0])); idx++)
+  {
+    info[idx].id = idx + 1U;
+    info[idx].errorCnt = 0U;
+    TEST_ASSERT_EQUAL(0, pthread_create(&threads[idx], NULL, memPoolStressThread,
+                                        &info[idx]));
+  }
+  for (size_t idx = 0; idx < (sizeof(threads)/sizeof(threads[0])); idx++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_join(threads[idx], NULL));
+    /* No block should have been handed out to more than one thread at a time. */
+    TEST_ASSERT_EQUAL(0U, info[idx].errorCnt);
+  }
+  /* No blocks should have been lost or duplicated. */
+  for (size_t idx = 0; idx < numBlocks; idx++)
+  {
+    allocBlocks[idx] = TbxMemPoolAllocate(blockSize);
+    TEST_ASSERT_NOT_NULL(allocBlocks[idx]);
+    for (size_t prevIdx = 0; prevIdx < idx; prevIdx++)
+    {
+      TEST_ASSERT_TRUE(allocBlocks[prevIdx] != allocBlocks[idx]);
+    }
+  }
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(blockSize));
+  /* Release the blocks again and give the memory of the memory pool back. */
+  for (size_t idx = 0; idx < numBlocks; idx++)
+  {
+    TbxMemPoolRelease(allocBlocks[idx]);
+  }
+  TbxMemPoolMagazineFlush();
+  TEST_ASSERT_EQUAL_UINT32(numBlocks, TbxMemPoolShrink(blockSize, 0U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolStress_ShouldAllocateAndReleaseFromThreads ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that a bitmap pool cannot be created with invalid parameters.
+**
+****************************************************************************************/
+void test_TbxBitPoolCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxBitPool * pool;
+
+  /* It should not be possible to create a bitmap pool without blocks. */
+  pool = TbxBitPoolCreate(0U, sizeof(uint32_t));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(pool);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a bitmap pool with empty blocks. */
+  pool = TbxBitPoolCreate(4U, 0U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(pool);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a bitmap pool without a heap region. */
+  pool = TbxBitPoolCreateFrom(NULL, 4U, sizeof(uint32_t));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(pool);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxBitPoolCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the blocks of a bitmap pool are packed without headers, that
+**            free blocks are found in all words of the bitmap and that blocks are
+**            released to the bitmap pool that they belong to.
+**
+****************************************************************************************/
+void test_TbxBitPoolAllocate_ShouldFindFreeBlocks(void)
+{
+  tTbxHeapRegion * region;
+  tTbxBitPool    * pool;
+  uint8_t        * mem[(sizeof(size_t) * 8U) + 6U];
+  uint32_t         invalidBlock = 0U;
+  const size_t     numBlocks = sizeof(mem) / sizeof(mem[0]);
+  const size_t     blockSize = sizeof(uint32_t);
+
+  /* Create a bitmap pool with blocks that span two words of its bitmap. Its memory is
+   * taken from a heap region with static memory, instead of from the default heap.
+   */
+  region = TbxHeapRegionCreate(bitPoolTestMem, sizeof(bitPoolTestMem));
+  TEST_ASSERT_NOT_NULL(region);
+  pool = TbxBitPoolCreateFrom(region, numBlocks, blockSize);
+  TEST_ASSERT_NOT_NULL(pool);
+  TEST_ASSERT_EQUAL(numBlocks, TbxBitPoolGetFree(pool));
+
+  /* Allocate all blocks. */
+  for (size_t idx = 0; idx < numBlocks; idx++)
+  {
+    mem[idx] = TbxBitPoolAllocate(pool);
+    TEST_ASSERT_NOT_NULL(mem[idx]);
+    /* Make sure the blocks are aligned and placed right after each other. */
+    TEST_ASSERT_EQUAL(0, (uintptr_t)mem[idx] & (blockSize - 1U));
+    TEST_ASSERT_EQUAL_PTR(&mem[0][idx * blockSize], mem[idx]);
+  }
+  TEST_ASSERT_EQUAL(0, TbxBitPoolGetFree(pool));
+  TEST_ASSERT_NULL(TbxBitPoolAllocate(pool));
+
+  /* Release a block in each word of the bitmap. The search starts at the word of the
+   * last release and wraps around to find the other block.
+   */
+  TbxBitPoolRelease(mem[1]);
+  TbxBitPoolRelease(mem[numBlocks - 1U]);
+  TEST_ASSERT_EQUAL(2U, TbxBitPoolGetFree(pool));
+  TEST_ASSERT_EQUAL_PTR(mem[numBlocks - 1U], TbxBitPoolAllocate(pool));
+  TEST_ASSERT_EQUAL_PTR(mem[1], TbxBitPoolAllocate(pool));
+  TEST_ASSERT_NULL(TbxBitPoolAllocate(pool));
+
+  /* Release all blocks. */
+  for (size_t idx = 0; idx < numBlocks; idx++)
+  {
+    TbxBitPoolRelease(mem[idx]);
+  }
+  TEST_ASSERT_EQUAL(numBlocks, TbxBitPoolGetFree(pool));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Releasing the same memory twice is not allowed. */
+  TbxBitPoolRelease(mem[0]);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Releasing memory that is not the start of a block is not allowed. */
+  mem[0] = TbxBitPoolAllocate(pool);
+  TEST_ASSERT_NOT_NULL(mem[0]);
+  TbxBitPoolRelease(&mem[0][1]);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  TbxBitPoolRelease(mem[0]);
+
+  /* Releasing memory that does not belong to a bitmap pool is not allowed. */
+  TbxBitPoolRelease(&invalidBlock);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure the free blocks were not affected. */
+  TEST_ASSERT_EQUAL(numBlocks, TbxBitPoolGetFree(pool));
+} /*** end of test_TbxBitPoolAllocate_ShouldFindFreeBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a TLSF allocator cannot be created with invalid parameters.
+**
+****************************************************************************************/
+void test_TbxTlsfCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxTlsf * tlsf;
+
+  /* It should not be possible to create a TLSF allocator without memory. */
+  tlsf = TbxTlsfCreate(NULL, sizeof(allocatorTestMem));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(tlsf);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a TLSF allocator of zero bytes. */
+  tlsf = TbxTlsfCreate(allocatorTestMem, 0);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(tlsf);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a TLSF allocator that is too small to even hold
+   * its own administration.
+   */
+  tlsf = TbxTlsfCreate(allocatorTestMem, sizeof(tTbxTlsf));
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(tlsf);
+  /* Make sure no assertion was triggered, because the parameters themselves are
+   * valid.
+   */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that memory of varying sizes can be allocated from a TLSF allocator
+**            and released again.
+**
+****************************************************************************************/
+void test_TbxTlsfAllocate_CanAllocateVaryingSizes(void)
+{
+  tTbxHeapRegion * region;
+  tTbxTlsf       * tlsf;
+  uint8_t        * tlsfMem;
+  size_t           tlsfSize;
+  size_t           initialFree;
+  uint8_t        * mem[4];
+  const size_t     sizes[] = { 1, 24, 100, 250 };
+
+  /* Create the TLSF allocator on all memory of a heap region with static memory. */
+  region = TbxHeapRegionCreate(allocatorTestMem, sizeof(allocatorTestMem));
+  TEST_ASSERT_NOT_NULL(region);
+  tlsfSize = TbxHeapRegionGetFree(region);
+  tlsfMem = TbxHeapRegionAllocate(region, tlsfSize);
+  TEST_ASSERT_NOT_NULL(tlsfMem);
+  tlsf = TbxTlsfCreate(tlsfMem, tlsfSize);
+  TEST_ASSERT_NOT_NULL(tlsf);
+  initialFree = TbxTlsfGetFree(tlsf);
+  TEST_ASSERT_GREATER_THAN(0, initialFree);
+
+  /* Allocate memory of varying sizes. */
+  for (size_t idx = 0; idx < (sizeof(sizes)/sizeof(sizes[0])); idx++)
+  {
+    mem[idx] = TbxTlsfAllocate(tlsf, sizes[idx]);
+    /* Make sure the allocation worked and that it is located in the TLSF memory. */
+    TEST_ASSERT_NOT_NULL(mem[idx]);
+    TEST_ASSERT_GREATER_OR_EQUAL((uintptr_t)&tlsfMem[0], (uintptr_t)mem[idx]);
+    TEST_ASSERT_LESS_THAN((uintptr_t)&tlsfMem[tlsfSize], 
+                          (uintptr_t)&mem[idx][sizes[idx]-1U]);
+    /* Make sure the start address is aligned to 8 bytes. */
+    TEST_ASSERT_EQUAL(0, (uintptr_t)mem[idx] & 7U);
+    /* Write to the allocated memory, which should not affect other allocations. */
+    for (size_t byteIdx = 0; byteIdx < sizes[idx]; byteIdx++)
+    {
+      mem[idx][byteIdx] = (uint8_t)idx;
+    }
+  }
+  TEST_ASSERT_LESS_THAN(initialFree, TbxTlsfGetFree(tlsf));
+
+  /* Verify the contents and release the allocations again. */
+  for (size_t idx = 0; idx < (sizeof(sizes)/sizeof(sizes[0])); idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(idx, mem[idx][0]);
+    TEST_ASSERT_EQUAL_UINT8(idx, mem[idx][sizes[idx]-1U]);
+    TbxTlsfRelease(tlsf, mem[idx]);
+  }
+  /* All memory should be free again. */
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+
+  /* Allocating more than what the TLSF allocator holds should not work. */
+  TEST_ASSERT_NULL(TbxTlsfAllocate(tlsf, tlsfSize));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfAllocate_CanAllocateVaryingSizes ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that released memory is merged with neighboring free memory, such
+**            that a larger allocation is possible afterwards.
+**
+****************************************************************************************/
+void test_TbxTlsfRelease_ShouldMergeFreeBlocks(void)
+{
+  tTbxHeapRegion * region;
+  tTbxTlsf       * tlsf;
+  void           * tlsfMem;
+  size_t           tlsfSize;
+  void           * mem[3];
+  void           * largeMem;
+  size_t           chunkSize;
+
+  /* Create the TLSF allocator on all memory of a heap region with static memory. */
+  region = TbxHeapRegionCreate(allocatorTestMem, sizeof(allocatorTestMem));
+  TEST_ASSERT_NOT_NULL(region);
+  tlsfSize = TbxHeapRegionGetFree(region);
+  tlsfMem = TbxHeapRegionAllocate(region, tlsfSize);
+  TEST_ASSERT_NOT_NULL(tlsfMem);
+  tlsf = TbxTlsfCreate(tlsfMem, tlsfSize);
+  TEST_ASSERT_NOT_NULL(tlsf);
+  /* Allocate three quarters of the free memory, in three parts. */
+  chunkSize = TbxTlsfGetFree(tlsf) / 4U;
+  mem[0] = TbxTlsfAllocate(tlsf, chunkSize);
+  mem[1] = TbxTlsfAllocate(tlsf, chunkSize);
+  mem[2] = TbxTlsfAllocate(tlsf, chunkSize);
+  TEST_ASSERT_NOT_NULL(mem[0]);
+  TEST_ASSERT_NOT_NULL(mem[1]);
+  TEST_ASSERT_NOT_NULL(mem[2]);
+  /* Without merging, it is not possible to allocate one and a half times the size. */
+  largeMem = TbxTlsfAllocate(tlsf, chunkSize + (chunkSize / 2U));
+  TEST_ASSERT_NULL(largeMem);
+
+  /* Release the first and the second part. These should be merged. */
+  TbxTlsfRelease(tlsf, mem[0]);
+  TbxTlsfRelease(tlsf, mem[1]);
+  /* Now it should be possible to allocate one and a half times the size, at the
+   * location of the first part.
+   */
+  largeMem = TbxTlsfAllocate(tlsf, chunkSize + (chunkSize / 2U));
+  TEST_ASSERT_EQUAL_PTR(mem[0], largeMem);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Releasing memory that does not belong to the TLSF allocator is not allowed. */
+  TbxTlsfRelease(tlsf, heapRegionMem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfRelease_ShouldMergeFreeBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a buddy allocator cannot be created with invalid parameters.
+**
+****************************************************************************************/
+void test_TbxBuddyCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxBuddy * buddy;
+
+  /* It should not be possible to create a buddy allocator with blocks that are too small
+   * to hold the free list pointers.
+   */
+  buddy = TbxBuddyCreate(sizeof(void *), 4U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(buddy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a buddy allocator with a minimum block size that
+   * is not a power of two.
+   */
+  buddy = TbxBuddyCreate(3U * sizeof(void *), 4U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(buddy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a buddy allocator without orders. */
+  buddy = TbxBuddyCreate(4U * sizeof(void *), 0U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(buddy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a buddy allocator without a heap region. */
+  buddy = TbxBuddyCreateFrom(NULL, 4U * sizeof(void *), 4U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(buddy);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxBuddyCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that blocks are split upon allocation and that buddies are merged
+**            again upon release.
+**
+****************************************************************************************/
+void test_TbxBuddyAllocate_ShouldSplitAndMergeBlocks(void)
+{
+  tTbxHeapRegion * region;
+  tTbxBuddy      * buddy;
+  uint8_t        * mem[4];
+  const size_t     minBlockSize = 2U * sizeof(void *);
+
+  /* Create a buddy allocator with 4 orders, so 8 blocks of the lowest order. Its memory
+   * is taken from a heap region with static memory, instead of from the default heap.
+   */
+  region = TbxHeapRegionCreate(allocatorTestMem, sizeof(allocatorTestMem));
+  TEST_ASSERT_NOT_NULL(region);
+  buddy = TbxBuddyCreateFrom(region, minBlockSize, 4U);
+  TEST_ASSERT_NOT_NULL(buddy);
+  TEST_ASSERT_EQUAL(8U * minBlockSize, TbxBuddyGetFree(buddy));
+
+  /* Allocate blocks of each order, except the highest one. This fills up all memory. */
+  mem[0] = TbxBuddyAllocate(buddy, 1U);
+  mem[1] = TbxBuddyAllocate(buddy, minBlockSize);
+  mem[2] = TbxBuddyAllocate(buddy, minBlockSize + 1U);
+  mem[3] = TbxBuddyAllocate(buddy, 4U * minBlockSize);
+  for (size_t idx = 0; idx < (sizeof(mem)/sizeof(mem[0])); idx++)
+  {
+    TEST_ASSERT_NOT_NULL(mem[idx]);
+    /* Make sure the start address is aligned to the minimum block size. */
+    TEST_ASSERT_EQUAL(0, (uintptr_t)mem[idx] & (minBlockSize - 1U));
+  }
+  /* The blocks should be the result of splitting the block of the highest order. */
+  TEST_ASSERT_EQUAL_PTR(&mem[0][minBlockSize], mem[1]);
+  TEST_ASSERT_EQUAL_PTR(&mem[0][2U * minBlockSize], mem[2]);
+  TEST_ASSERT_EQUAL_PTR(&mem[0][4U * minBlockSize], mem[3]);
+  TEST_ASSERT_EQUAL(0, TbxBuddyGetFree(buddy));
+  TEST_ASSERT_NULL(TbxBuddyAllocate(buddy, 1U));
+
+  /* Release the first two blocks. These are buddies, so they should be merged. */
+  TbxBuddyRelease(buddy, mem[1]);
+  TbxBuddyRelease(buddy, mem[0]);
+  TEST_ASSERT_EQUAL(2U * minBlockSize, TbxBuddyGetFree(buddy));
+  TEST_ASSERT_EQUAL_PTR(mem[0], TbxBuddyAllocate(buddy, 2U * minBlockSize));
+
+  /* Release all blocks. These should be merged into the block of the highest order. */
+  TbxBuddyRelease(buddy, mem[0]);
+  TbxBuddyRelease(buddy, mem[3]);
+  TbxBuddyRelease(buddy, mem[2]);
+  TEST_ASSERT_EQUAL(8U * minBlockSize, TbxBuddyGetFree(buddy));
+  TEST_ASSERT_EQUAL_PTR(mem[0], TbxBuddyAllocate(buddy, 8U * minBlockSize));
+  TbxBuddyRelease(buddy, mem[0]);
+
+  /* Allocating more than what the buddy allocator holds should not work. */
+  TEST_ASSERT_NULL(TbxBuddyAllocate(buddy, (8U * minBlockSize) + 1U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Releasing the same memory twice is not allowed. */
+  TbxBuddyRelease(buddy, mem[0]);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure the free memory was not affected. */
+  TEST_ASSERT_EQUAL(8U * minBlockSize, TbxBuddyGetFree(buddy));
+} /*** end of test_TbxBuddyAllocate_ShouldSplitAndMergeBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a handle based memory allocator cannot be created with invalid
+**            parameters.
+**
+****************************************************************************************/
+void test_TbxHmemCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxHmem * hmem;
+
+  /* It should not be possible to create an allocator of zero bytes. */
+  hmem = TbxHmemCreate(0U, 4U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(hmem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create an allocator without handles. */
+  hmem = TbxHmemCreate(128U, 0U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(hmem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create an allocator without a heap region. */
+  hmem = TbxHmemCreateFrom(NULL, 128U, 4U);
+  /* Make sure the creation failed. */
+  TEST_ASSERT_NULL(hmem);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxHmemCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that compaction slides allocated blocks together, while keeping their
+**            contents and skipping locked blocks.
+**
+****************************************************************************************/
+void test_TbxHmemCompact_ShouldSlideBlocksTogether(void)
+{
+  tTbxHeapRegion * region;
+  tTbxHmem       * hmem;
+  tTbxHmemHandle   handle[3];
+  uint8_t        * mem[3];
+  uint8_t        * lockedMem;
+
+  /* Create the allocator. Its memory is taken from a heap region with static memory,
+   * instead of from the default heap.
+   */
+  region = TbxHeapRegionCreate(allocatorTestMem, sizeof(allocatorTestMem));
+  TEST_ASSERT_NOT_NULL(region);
+  hmem = TbxHmemCreateFrom(region, 128U, 4U);
+  TEST_ASSERT_NOT_NULL(hmem);
+  TEST_ASSERT_EQUAL(128U, TbxHmemGetFree(hmem));
+
+  /* Allocate three blocks and fill them with data. */
+  for (size_t idx = 0; idx < (sizeof(handle)/sizeof(handle[0])); idx++)
+  {
+    handle[idx] = TbxHmemAllocate(hmem, 16U);
+    TEST_ASSERT_NOT_EQUAL(TBX_HMEM_HANDLE_INVALID, handle[idx]);
+    mem[idx] = TbxHmemLock(hmem, handle[idx]);
+    TEST_ASSERT_NOT_NULL(mem[idx]);
+    for (size_t byteIdx = 0; byteIdx < 16U; byteIdx++)
+    {
+      mem[idx][byteIdx] = (uint8_t)(idx + byteIdx);
+    }
+    TbxHmemUnlock(hmem, handle[idx]);
+  }
+  /* Compacting without free blocks in between should not move anything. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_TRUE, TbxHmemCompact(hmem, 128U));
+  TEST_ASSERT_EQUAL_PTR(mem[2], TbxHmemLock(hmem, handle[2]));
+  TbxHmemUnlock(hmem, handle[2]);
+
+  /* Release the first block, which leaves a free block at the start. */
+  TbxHmemRelease(hmem, handle[0]);
+  /* A compaction step with a small budget should only move the second block. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_FALSE, TbxHmemCompact(hmem, 1U));
+  TEST_ASSERT_EQUAL_PTR(mem[0], TbxHmemLock(hmem, handle[1]));
+  TbxHmemUnlock(hmem, handle[1]);
+  /* The next compaction step should move the third block and complete. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_TRUE, TbxHmemCompact(hmem, 1U));
+  lockedMem = TbxHmemLock(hmem, handle[2]);
+  TEST_ASSERT_EQUAL_PTR(mem[1], lockedMem);
+  /* Make sure the contents moved along. */
+  for (size_t byteIdx = 0; byteIdx < 16U; byteIdx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(2U + byteIdx, lockedMem[byteIdx]);
+  }
+
+  /* Release the second block. The locked third block should not be moved. */
+  TbxHmemRelease(hmem, handle[1]);
+  TEST_ASSERT_EQUAL_UINT8(TBX_TRUE, TbxHmemCompact(hmem, 128U));
+  TEST_ASSERT_EQUAL_PTR(lockedMem, TbxHmemLock(hmem, handle[2]));
+  TbxHmemUnlock(hmem, handle[2]);
+  TbxHmemUnlock(hmem, handle[2]);
+  /* Once unlocked, it should be moved to the start. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_TRUE, TbxHmemCompact(hmem, 128U));
+  TEST_ASSERT_EQUAL_PTR(mem[0], TbxHmemLock(hmem, handle[2]));
+  TbxHmemUnlock(hmem, handle[2]);
+  TbxHmemRelease(hmem, handle[2]);
+  TEST_ASSERT_EQUAL(128U, TbxHmemGetFree(hmem));
+
+  /* Allocating more than what the allocator holds should not work. */
+  TEST_ASSERT_EQUAL(TBX_HMEM_HANDLE_INVALID, TbxHmemAllocate(hmem, 128U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Releasing a handle that is no longer in use is not allowed. */
+  TbxHmemRelease(hmem, handle[2]);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxHmemCompact_ShouldSlideBlocksTogether ***/
+
+
 /************************************************************************************//**
 ** \brief     Tests that a new list can be created.
 **
@@ -2466,6 +4128,22 @@ int runTests(void)
   RUN_TEST(test_TbxHeapAllocate_ShouldReturnNullIfZeroSizeAllocated);
   RUN_TEST(test_TbxHeapAllocate_ShouldReturnNullIfTooMuchAllocated);
   RUN_TEST(test_TbxHeapAllocate_ShouldAlignToAddressSize);
+  RUN_TEST(test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHeapAllocateAligned_ShouldReturnAlignedMemory);
+  RUN_TEST(test_TbxHeapAllocateTagged_ShouldAllocateFromHeap);
+#if defined(TBX_CONF_HEAP_CHUNK_SIZE) && (TBX_CONF_HEAP_CHUNK_SIZE > 0U)
+  RUN_TEST(test_TbxHeapAllocate_ShouldServeSmallAllocationsFromThreadChunk);
+#endif
+#if defined(TBX_CONF_HEAP_GROW_SIZE) && (TBX_CONF_HEAP_GROW_SIZE > 0U)
+  RUN_TEST(test_TbxHeapAllocate_ShouldGrowBeyondHeapBuffer);
+#endif
+#if (TBX_CONF_HEAP_TRACE_ENABLE > 0U)
+  RUN_TEST(test_TbxHeapTrace_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHeapTrace_ShouldRecordAllocations);
+#endif
+  RUN_TEST(test_TbxHeapRegionCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHeapRegionAllocate_ShouldAllocateFromRegion);
+  RUN_TEST(test_TbxHeapRegionRewind_ShouldReleaseToMark);
   /* Tests for the random number module. */
   RUN_TEST(test_TbxRandomSetSeedInitHandler_ShouldTriggerAssertionIfParamNull);
   RUN_TEST(test_TbxRandomSetSeedInitHandler_ShouldWork);
@@ -2498,6 +4176,39 @@ int runTests(void)
   RUN_TEST(test_TbxMemPoolAllocateAuto_CanResizeWhenFull);
   RUN_TEST(test_TbxMemPoolAllocateAllocateAuto_CanReallocate);
   RUN_TEST(test_TbxMemPoolAllocateAuto_CannotAllocateSmallerSize);
+  RUN_TEST(test_TbxMemPoolAllocate_CannotAllocateBeyondIndex);
+  RUN_TEST(test_TbxMemPoolCreate_ShouldCreateContiguousBlocks);
+  RUN_TEST(test_TbxMemPoolMagazineFlush_ShouldKeepBlocksAvailable);
+  RUN_TEST(test_TbxMemPoolGrow_ShouldFollowGrowthPolicy);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+  RUN_TEST(test_TbxMemPoolGetStats_ShouldCountBlocks);
+#endif
+  RUN_TEST(test_TbxMemPoolCreateAligned_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolCreateAligned_ShouldAlignBlocks);
+  RUN_TEST(test_TbxMemPoolBatch_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolBatch_CanAllocateAndRelease);
+  RUN_TEST(test_TbxMemPoolShrink_ShouldReleaseReusedSlabs);
+  RUN_TEST(test_TbxMemPoolShrink_ShouldReuseFreeSlabs);
+  RUN_TEST(test_TbxMemPoolHandle_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolHandle_CanAllocateAndRelease);
+  RUN_TEST(test_TbxMemPoolReallocate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolReallocate_ShouldGrowInPlaceOrMove);
+#if defined(TBX_PORT_THREAD_LOCAL)
+  RUN_TEST(test_TbxMemPoolStress_ShouldAllocateAndReleaseFromThreads);
+#endif
+  /* Tests for the bitmap pool module. */
+  RUN_TEST(test_TbxBitPoolCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxBitPoolAllocate_ShouldFindFreeBlocks);
+  /* Tests for the TLSF memory allocator module. */
+  RUN_TEST(test_TbxTlsfCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxTlsfAllocate_CanAllocateVaryingSizes);
+  RUN_TEST(test_TbxTlsfRelease_ShouldMergeFreeBlocks);
+  /* Tests for the buddy memory allocator module. */
+  RUN_TEST(test_TbxBuddyCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxBuddyAllocate_ShouldSplitAndMergeBlocks);
+  /* Tests for the handle based memory allocator module. */
+  RUN_TEST(test_TbxHmemCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHmemCompact_ShouldSlideBlocksTogether);
   /* Tests for the linked list module. */
   RUN_TEST(test_TbxListCreate_ReturnsValidListPointer);
   RUN_TEST(test_TbxListCreate_CanReuseMemory);